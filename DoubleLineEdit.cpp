@@ -1,6 +1,6 @@
 #include "DoubleLineEdit.h"
 #include "Ranges.h"
-#include "TrianglePaintedButton.h"
+#include "IntegerMath.h"
 
 #include <QKeyEvent>
 #include <QFocusEvent>
@@ -32,7 +32,7 @@ DoubleLineEdit::DoubleLineEdit(QWidget* parent, int decimals, bool isSigned)
 
     if(m_signed){
 
-        m_signChar  = new RangeChar('-', '+');
+        m_signChar  = m_rangePool.create<RangeChar>('-', '+');
         m_ranges << m_signChar;
 
     }
@@ -41,7 +41,7 @@ DoubleLineEdit::DoubleLineEdit(QWidget* parent, int decimals, bool isSigned)
     //This causes us to have to give up significant figures to the left of the decimal by a factor of 10 for each decimal more we want
     //to represent. If we were to not do this, and we made a Range close to long long max with values to the right of the decimal,
     //it may be completely disregarded due to the amount of gauranteed precision being invalidated by having >16 bits.
-    m_doubleInt = new RangeInt(std::numeric_limits<long long>::max() / (100000LL * std::pow(10LL, decimals + 1) ), 1LL, true, m_signed);
+    m_doubleInt = m_rangePool.create<RangeInt>(maximumIntegerRange(decimals), 1LL, true, m_signed);
 
     m_ranges << m_doubleInt;
     m_prevCursorPosition = 0;
@@ -51,26 +51,19 @@ DoubleLineEdit::DoubleLineEdit(QWidget* parent, int decimals, bool isSigned)
     RangeLineEdit::setPrecision(decimals);
 
     setCursorPosition(0);
-    setMinimumWidth(QFontMetrics(font()).horizontalAdvance(text()) + m_incrementButton->width());
+    setMinimumWidth(QFontMetrics(font()).horizontalAdvance(text()) + STEP_BUTTON_MAXIMUM_WIDTH);
 
 }
 
 /*
- * Convenience function for dynamically changing the precision of the decimals.
- * Overridden to appropriately limit the m_doubleInt's maximum range such that large values don't truncate decimal precision
- * when converting the underlying value of the all Ranges back to a standard long double.
+ * Returns the largest integer Range that still leaves room for the requested decimal precision,
+ * i.e. LLONG_MAX / (100000 * 10^(decimals + 1)). Exponents past what a long long can hold leave no integer range at all.
  */
-void DoubleLineEdit::setPrecision(int decimals){
+long long DoubleLineEdit::maximumIntegerRange(int decimals){
 
-    //This needs to be done prior to clearing and resyncing, but we're sure it'll succeed if the decimals >= 0
-    if(decimals >= 0){
+    int exponent = decimals + 6;
 
-        m_doubleInt->setRange(std::numeric_limits<long long>::max() / (100000LL * std::pow(10LL, decimals + 1)));
-        m_maxAllowableValue = m_doubleInt->m_range;
-
-    }
-
-    RangeLineEdit::setPrecision(decimals);
+    return (exponent > MAX_POW10_LL_EXPONENT) ? 0LL : std::numeric_limits<long long>::max() / pow10LL(exponent);
 
 }
 
@@ -79,6 +72,8 @@ void DoubleLineEdit::setPrecision(int decimals){
  */
 bool DoubleLineEdit::setValueForIndex(const QChar& value, int index){
 
+    BatchUpdate batch(this);
+
     bool successful(RangeLineEdit::setValueForIndex(value, index));
 
     if(successful){
@@ -97,12 +92,14 @@ bool DoubleLineEdit::setValueForIndex(const QChar& value, int index){
  */
 void DoubleLineEdit::setValue(long double value){
 
-    const long double originalValue = DoubleLineEdit::value();
+    //Production::Note: Everything below is rendered once, and valueChanged emitted at most once, when this scope ends
+    BatchUpdate batch(this);
 
     if(m_signed){
 
         QChar signChar = value >= 0 ? m_signChar->m_positiveChar : m_signChar->m_negativeChar;
         m_signChar->m_value = signChar;
+        m_signChar->m_dirty = true;
 
         if(value < 0.0){
 
@@ -120,82 +117,12 @@ void DoubleLineEdit::setValue(long double value){
 
     }
 
-    long double integer             = std::floor(value);
-    long double decimalNotTruncated = 0.0L;
-    long double decimal             = 0.0L;
-
-    if(m_decimalRange != nullptr){
-
-        //Production::Note: m_decimalRange->m_range == std::pow(10, m_decimals) - 1, so we need to divide cleanly by 10, 100, 1000, etc., not 9, 99, 999
-        decimalNotTruncated = (value - integer) * (m_decimalRange->m_range);
-        decimal             = std::floor(decimalNotTruncated);
-
-    }
-
-    m_doubleInt->m_value = integer;
-
-    long double minimumDecimalValue(m_doubleInt->m_divisor);
-
-    //If the user hasn't specified decimals, we need to ignore its value in determining precision loss
-    if(m_decimalRange != nullptr){
-
-        m_decimalRange->m_value = decimal;
-
-        //Production::Note: The below episolon scales with how many decimals are being used, so it's completely dynamic
-        minimumDecimalValue = (1.0L / static_cast<long double>(m_decimalRange->divisor()));
-
-    }
-
-    //This may or may not include decimal values
-    m_undisplayedPrecision = value - sumRangeInts();
-
-    const long double epsilonErrorAllowed(minimumDecimalValue / 10.0L);
-    if(m_undisplayedPrecision > epsilonErrorAllowed){
-
-        //Production::Note: If we found enough error to be greater than the epsilon,
-        //that implies we SHOULD have incremented one more time,
-        //but because doubles and floats are sometimes imprecise during arithmetic operations with certain values,
-        //it erroneously floored an extra decimal value.
-        //If we can increment the decimal range it should fix up any visual desync occurring from being off by 1 decimal.
-        if((m_decimalRange != nullptr && m_decimalRange->increment(0)) || m_doubleInt->increment(0)){
-
-            if(value >= 0.0L){
-
-                //We also need to remove from the undisplayed precision the amount we were able to increment by (Brings is closer to 0)
-                m_undisplayedPrecision -= minimumDecimalValue;
-
-            }else{
-
-                //We also need to remove from the undisplayed precision the amount we were able to increment by (Brings is closer to 0)
-                m_undisplayedPrecision += minimumDecimalValue;
-
-            }
-
-        }
-
-    }
-
-    const QString originalString = text();
+    //The RangeInts hold the value as an exact count of the smallest displayed unit, anything finer is kept as undisplayed precision
+    m_undisplayedPrecision = value - setRangeIntMagnitudes(value);
 
     syncRangeSigns();
     maximumExceededFixup();
 
-    //If our underlying precision changed, but we can't display the visual change, the text wouldn't have changed
-    //during the calls to the above two functions. As a result, we'd erroneously not emit our value changed,
-    //so if we changed something the user can't see, we still want to emit the signal properly, but ensure we don't blindly
-    //double emit valueChanged for no reason.
-    if(originalString == text()){
-
-       const long double newValue = DoubleLineEdit::value();
-
-       if(originalValue != newValue){
-
-           emit valueChanged(newValue);
-
-       }
-
-    }
-
 }
 
 /*
@@ -237,54 +164,62 @@ void DoubleLineEdit::clearCurrentValidators(){
 }
 
 /*
- * Attempts to increment the Range at the current cursor index, resets undisplayed precision to 0 if the text changed
+ * Overridden to appropriately limit the m_doubleInt's maximum range such that large values don't truncate decimal precision
+ * when converting the underlying value of the all Ranges back to a standard long double.
  */
-void DoubleLineEdit::increment(){
+void DoubleLineEdit::applyPrecision(int decimals, long long decimalDivisor){
+
+    const int previousLength = m_doubleInt->rangeLength();
 
-    const QString prevText(text());
+    m_doubleInt->setRange(maximumIntegerRange(decimals));
+    m_maxAllowableValue = m_doubleInt->m_range;
 
-    RangeLineEdit::increment();
+    RangeLineEdit::applyPrecision(decimals, decimalDivisor);
 
-    if(prevText != text()){
+    //The integer RangeInt's width follows its range, so when only the decimal RangeInt was retargeted everything from the integer on has moved
+    if(m_doubleInt->rangeLength() != previousLength){
 
-        m_undisplayedPrecision = 0.0;
+        syncRangeIndicesFrom(m_doubleInt);
 
     }
 
 }
 
 /*
- * Attempts to decrement the Range at the current cursor index, resets undisplayed precision to 0 if the text changed
+ * Calls base class implementation, and resets undisplayed precision to 0 if any Range changed
  */
-void DoubleLineEdit::decrement(){
+bool DoubleLineEdit::stepBy(long long steps, int charIndex){
 
-    const QString prevText(text());
+    //Batched, so valueChanged is emitted after the undisplayed precision is dropped, not before
+    BatchUpdate batch(this);
 
-    RangeLineEdit::decrement();
+    const bool stepped = RangeLineEdit::stepBy(steps, charIndex);
 
-    if(prevText != text()){
+    if(stepped){
 
         m_undisplayedPrecision = 0.0;
 
     }
 
+    return stepped;
+
 }
 
 /*
- * Helper function that ensures any changes to the value of a Range will not exceed the maximum allowable set value.
- * If the maximum is exceeded, the first-most RangeInt will be set to its range and all subsequent RangeInts will be zeroed out.
+ * Resets undisplayed precision to 0, since the value was clamped to exactly the maximum allowable value
  */
-void DoubleLineEdit::maximumExceededFixup(){
-
-    const QString prevText(text());
+void DoubleLineEdit::maximumWasExceeded(){
 
-    RangeLineEdit::maximumExceededFixup();
+    m_undisplayedPrecision = 0.0;
 
-    if(prevText != text()){
+}
 
-        m_undisplayedPrecision = 0.0;
+/*
+ * Returns the undisplayed precision, so a BatchUpdate that only changed it still emits valueChanged
+ */
+long double DoubleLineEdit::undisplayedPrecision() const{
 
-    }
+    return m_undisplayedPrecision;
 
 }
 
@@ -299,7 +234,7 @@ void DoubleLineEdit::showContextMenu(const QPoint& pos){
 
         bool canConvertToDecimal(false);
         QGuiApplication::clipboard()->text().toDouble(&canConvertToDecimal);
-        m_pasteAsValueFromClipBoardAction->setEnabled(canConvertToDecimal);
+        sharedContextMenu().m_pasteAsValueFromClipBoardAction->setEnabled(canConvertToDecimal);
 
     }
 
@@ -357,6 +292,8 @@ void DoubleLineEdit::valueChangedPrivate(){
  */
 void DoubleLineEdit::clearText(){
 
+    BatchUpdate batch(this);
+
     RangeLineEdit::clearText();
 
     m_undisplayedPrecision = 0.0;
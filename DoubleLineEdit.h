@@ -23,14 +23,6 @@ public:
      */
     DoubleLineEdit(QWidget* parent = nullptr, int decimals = 2, bool isSigned = true);
 
-    /*
-     * Convenience function for dynamically changing the precision of the decimals.
-     * Overridden to appropriately limit the m_doubleInt's maximum range such that large values don't truncate decimal precision
-     * when converting the underlying value of the all Ranges back to a standard long double.
-     * @PARAM int decimals - Decimal precision to be displayed. Can be set to 0 which will remove precision values, if already set.
-     */
-    void setPrecision(int decimals) override;
-
     /*
      * Calls base class implementation, and if successful will reset undisplayed precision to 0
      * @PARAM const QChar& value - The String to set at the given index
@@ -38,6 +30,13 @@ public:
      */
     bool setValueForIndex(const QChar& value, int index) override;
 
+    /*
+     * Calls base class implementation, and resets undisplayed precision to 0 if any Range changed
+     * @PARAM long long steps     - How many units to step by, negative to step down
+     * @PARAM int       charIndex - The index of the digit to step
+     */
+    bool stepBy(long long steps, int charIndex) override;
+
     /*
      * Force the specialized parameratized subclass to have to define how its underling Ranges should be converted to some usable value
      * This mimics Qt'isms where their widgets that have a value, normally have a callable T::value().
@@ -60,20 +59,28 @@ protected:
     void clearCurrentValidators() override;
 
     /*
-     * Attempts to increment the Range at the current cursor index, resets undisplayed precision to 0 if the text changed
+     * Overridden to appropriately limit the m_doubleInt's maximum range such that large values don't truncate decimal precision
+     * when converting the underlying value of the all Ranges back to a standard long double.
+     * @PARAM int       decimals       - Decimal precision to be displayed
+     * @PARAM long long decimalDivisor - The decimal RangeInt's divisor at that precision
+     */
+    void applyPrecision(int decimals, long long decimalDivisor) override;
+
+    /*
+     * Resets undisplayed precision to 0, since the value was clamped to exactly the maximum allowable value
      */
-    void increment() override;
+    void maximumWasExceeded() override;
 
     /*
-     * Attempts to decrement the Range at the current cursor index, resets undisplayed precision to 0 if the text changed
+     * Returns the undisplayed precision, so a BatchUpdate that only changed it still emits valueChanged
      */
-    void decrement() override;
+    long double undisplayedPrecision() const override;
 
     /*
-     * Helper function that ensures any changes to the value of a Range will not exceed the maximum allowable set value.
-     * If the maximum is exceeded, the first-most RangeInt will be set to its range and all subsequent RangeInts will be zeroed out.
+     * Returns the maximum range of the integer RangeInt that still guarantees the requested decimal precision survives a long double round trip
+     * @PARAM int decimals - Decimal precision to be displayed
      */
-    void maximumExceededFixup();
+    static long long maximumIntegerRange(int decimals);
 
 protected slots:
 
@@ -0,0 +1,141 @@
+#ifndef INTEGERMATH_H
+#define INTEGERMATH_H
+
+#include <climits>
+
+/*! IntegerMath
+ *
+ * Compile-time power-of-ten tables and checked integer helpers shared by the Range suite.
+ * Every carry, divisor and precision computation goes through these instead of std::pow(...),
+ * so stepping is pure integer work and stays exact for every digit a long long can hold.
+ *
+ * WideInt is the widest native signed integer available. It's a 128-bit integer on compilers
+ * that provide one (GCC, Clang), and falls back to long long elsewhere (MSVC).
+ */
+
+#if defined(__SIZEOF_INT128__)
+typedef __int128 WideInt;
+static constexpr int MAX_POW10_WIDE_EXPONENT = 38;
+#else
+typedef long long WideInt;
+static constexpr int MAX_POW10_WIDE_EXPONENT = 18;
+#endif
+
+//10^18 is the largest power of ten a long long can hold
+static constexpr int MAX_POW10_LL_EXPONENT = 18;
+
+/*! struct Pow10Table
+ *
+ * Literal type that fills its table with 10^0 ... 10^(Size - 1) at compile time.
+ */
+template <typename IntType, int Size>
+struct Pow10Table{
+
+    constexpr Pow10Table()
+        : m_values()
+    {
+
+        m_values[0] = IntType(1);
+        for(int i = 1; i < Size; ++i){
+
+            m_values[i] = m_values[i - 1] * 10;
+
+        }
+
+    }
+
+    IntType m_values[Size];
+
+};
+
+static constexpr Pow10Table<long long, MAX_POW10_LL_EXPONENT   + 1> POW10_LL_TABLE  {};
+static constexpr Pow10Table<WideInt,   MAX_POW10_WIDE_EXPONENT + 1> POW10_WIDE_TABLE{};
+
+/*
+ * Returns 10^exponent as a long long.
+ * Checked: negative exponents return 0 (10^-n truncates to 0) and exponents past MAX_POW10_LL_EXPONENT saturate to LLONG_MAX.
+ * @PARAM int exponent - The power of ten to look up
+ */
+constexpr long long pow10LL(int exponent){
+
+    return exponent < 0                     ? 0LL       :
+           exponent > MAX_POW10_LL_EXPONENT ? LLONG_MAX :
+                                              POW10_LL_TABLE.m_values[exponent];
+
+}
+
+/*
+ * Returns 10^exponent as a WideInt.
+ * Checked: negative exponents return 0 and exponents past MAX_POW10_WIDE_EXPONENT saturate to the largest tabulated power.
+ * @PARAM int exponent - The power of ten to look up
+ */
+constexpr WideInt pow10Wide(int exponent){
+
+    return exponent < 0                       ? WideInt(0)                                              :
+           exponent > MAX_POW10_WIDE_EXPONENT ? POW10_WIDE_TABLE.m_values[MAX_POW10_WIDE_EXPONENT] :
+                                                POW10_WIDE_TABLE.m_values[exponent];
+
+}
+
+/*
+ * Multiplies two non-negative long longs, returning false (and leaving result untouched) if the product would overflow.
+ * @PARAM long long  a      - Left hand operand (>= 0)
+ * @PARAM long long  b      - Right hand operand (>= 0)
+ * @PARAM long long& result - Receives a * b on success
+ */
+inline bool checkedMultiply(long long a, long long b, long long& result){
+
+    if(a < 0LL || b < 0LL || (b != 0LL && a > LLONG_MAX / b)){
+
+        return false;
+
+    }
+
+    result = a * b;
+
+    return true;
+
+}
+
+//Production::Note: Built without shifting into the sign bit, which isn't a constant expression for signed types
+static constexpr WideInt WIDE_INT_MAX = ((WideInt(1) << (sizeof(WideInt) * 8 - 2)) - 1) * 2 + 1;
+
+/*
+ * Adds two WideInts, saturating to +/-WIDE_INT_MAX instead of overflowing.
+ * @PARAM WideInt a - Left hand operand
+ * @PARAM WideInt b - Right hand operand
+ */
+inline WideInt saturatingAdd(WideInt a, WideInt b){
+
+    if(a > 0 && b > WIDE_INT_MAX - a){
+
+        return WIDE_INT_MAX;
+
+    }else if(a < 0 && b < -WIDE_INT_MAX - a){
+
+        return -WIDE_INT_MAX;
+
+    }
+
+    return a + b;
+
+}
+
+/*
+ * Multiplies two non-negative WideInts, saturating to WIDE_INT_MAX instead of overflowing.
+ * @PARAM WideInt a - Left hand operand (>= 0)
+ * @PARAM WideInt b - Right hand operand (>= 0)
+ */
+inline WideInt saturatingMultiply(WideInt a, WideInt b){
+
+    if(b != 0 && a > WIDE_INT_MAX / b){
+
+        return WIDE_INT_MAX;
+
+    }
+
+    return a * b;
+
+}
+
+#endif // INTEGERMATH_H
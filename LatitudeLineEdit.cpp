@@ -1,5 +1,4 @@
 #include "LatitudeLineEdit.h"
-#include "TrianglePaintedButton.h"
 #include "Ranges.h"
 
 /*
@@ -9,15 +8,7 @@ LatitudeLineEdit::LatitudeLineEdit(QWidget* parent, int decimals)
     : PositionalLineEdit(parent)
 {
 
-    m_degreeChar   = new RangeChar('S', 'N');
-    m_degreeInt    = new RangeInt(90, 1);
-    m_degreeSymbol = new RangeStringConstant("°");
-    m_minuteInt    = new RangeInt(59, 60);
-    m_minuteSymbol = new RangeStringConstant("'");
-    m_secondsInt   = new RangeInt(59, 3600);
-    m_secondSymbol = new RangeStringConstant("''");
-
-    m_ranges << m_degreeChar << m_degreeInt << m_degreeSymbol << m_minuteInt << m_minuteSymbol << m_secondsInt << m_secondSymbol;
+    buildLayout<PositionalRangeLayout<u'S', u'N', 90>>();
     m_prevCursorPosition = 0;
     syncRangeEdges();
 
@@ -25,6 +16,6 @@ LatitudeLineEdit::LatitudeLineEdit(QWidget* parent, int decimals)
     setPrecision(decimals);
 
     setCursorPosition(0);
-    setMinimumWidth(QFontMetrics(font()).horizontalAdvance(text()) + m_incrementButton->width());
+    setMinimumWidth(QFontMetrics(font()).horizontalAdvance(text()) + STEP_BUTTON_MAXIMUM_WIDTH);
 
 }
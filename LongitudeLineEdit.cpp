@@ -1,5 +1,4 @@
 #include "LongitudeLineEdit.h"
-#include "TrianglePaintedButton.h"
 #include "Ranges.h"
 
 /*
@@ -9,15 +8,7 @@ LongitudeLineEdit::LongitudeLineEdit(QWidget* parent, int decimals)
     : PositionalLineEdit(parent)
 {
 
-    m_degreeChar   = new RangeChar('W', 'E');
-    m_degreeInt    = new RangeInt(180, 1);
-    m_degreeSymbol = new RangeStringConstant("°");
-    m_minuteInt    = new RangeInt(59, 60);
-    m_minuteSymbol = new RangeStringConstant("'");
-    m_secondsInt   = new RangeInt(59, 3600);
-    m_secondSymbol = new RangeStringConstant("''");
-
-    m_ranges << m_degreeChar << m_degreeInt << m_degreeSymbol << m_minuteInt << m_minuteSymbol << m_secondsInt << m_secondSymbol;
+    buildLayout<PositionalRangeLayout<u'W', u'E', 180>>();
     m_prevCursorPosition = 0;
     syncRangeEdges();
 
@@ -25,6 +16,6 @@ LongitudeLineEdit::LongitudeLineEdit(QWidget* parent, int decimals)
     setPrecision(decimals);
 
     setCursorPosition(0);
-    setMinimumWidth(QFontMetrics(font()).horizontalAdvance(text()) + m_incrementButton->width());
+    setMinimumWidth(QFontMetrics(font()).horizontalAdvance(text()) + STEP_BUTTON_MAXIMUM_WIDTH);
 
 }
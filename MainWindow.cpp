@@ -7,9 +7,24 @@
 #include <QHBoxLayout>
 #include <QPushButton>
 #include <QLabel>
+#include <QGridLayout>
+#include <QScrollArea>
+#include <QElapsedTimer>
+#include <QPixmap>
+#include <QCursor>
+#include <QEvent>
+#include <QTimer>
+
+#include <algorithm>
 
 MainWindow::MainWindow(QWidget* parent)
-    : QMainWindow(parent)
+    : QMainWindow             (parent),
+      m_benchmarkGridLayout   (nullptr),
+      m_benchmarkColumnCount  (0),
+      m_hoverSweepTimer       (nullptr),
+      m_hoverSweepStep        (0),
+      m_hoverSweepEventCount  (0),
+      m_hoverSweepRepaintCount(0)
 {
 
     m_tabWidget = new QTabWidget;
@@ -18,6 +33,7 @@ MainWindow::MainWindow(QWidget* parent)
     setupDMSWidget();
     setupDoubleWidget();
     setupPhoneWidget();
+    setupBenchmarkWidget();
 
 }
 
@@ -229,6 +245,221 @@ void MainWindow::setupPhoneWidget(){
 
 }
 
+void MainWindow::setupBenchmarkWidget(){
+
+    m_benchmarkWidget = new QWidget;
+
+    QVBoxLayout* centralVLayout = new QVBoxLayout;
+    m_benchmarkWidget->setLayout(centralVLayout);
+
+    QHBoxLayout* runBenchmarkLayout        = new QHBoxLayout;
+    QPushButton* runRepaintBenchmarkButton = new QPushButton("Run Repaint Benchmark");
+    QLabel*      repaintBenchmarkLabel     = new QLabel("Repaints a grid of 1,000 editors, with and without the step arrow cache");
+
+    runBenchmarkLayout->addWidget(runRepaintBenchmarkButton);
+    runBenchmarkLayout->addWidget(repaintBenchmarkLabel);
+    centralVLayout    ->addLayout(runBenchmarkLayout);
+
+    QHBoxLayout* hoverSweepLayout     = new QHBoxLayout;
+    QPushButton* runHoverSweepButton  = new QPushButton("Run Hover Sweep");
+    QLabel*      hoverSweepLabel      = new QLabel("Moves the pointer across every editor of a 50x40 grid, counting the mouse and hover events they handle and their repaints");
+
+    hoverSweepLayout->addWidget(runHoverSweepButton);
+    hoverSweepLayout->addWidget(hoverSweepLabel);
+    centralVLayout  ->addLayout(hoverSweepLayout);
+
+    QScrollArea* benchmarkScrollArea = new QScrollArea;
+    QWidget*     benchmarkGridWidget = new QWidget;
+
+    m_benchmarkGridLayout = new QGridLayout;
+    benchmarkGridWidget->setLayout(m_benchmarkGridLayout);
+    benchmarkScrollArea->setWidget(benchmarkGridWidget);
+    benchmarkScrollArea->setWidgetResizable(true);
+    centralVLayout     ->addWidget(benchmarkScrollArea);
+
+    m_hoverSweepTimer = new QTimer(this);
+
+    connect(runRepaintBenchmarkButton, &QPushButton::clicked, this, [this, repaintBenchmarkLabel](){
+
+        const int repaintRounds(20);
+
+        populateBenchmarkGrid(100, 10);
+
+        //Every editor in the grid has the same size, so they can all be rendered into the same pixmap
+        QPixmap renderTarget(m_benchmarkLineEdits.first()->size());
+
+        auto nanosecondsPerRepaint = [this, &renderTarget, repaintRounds](){
+
+            //One untimed pass, so the cached run measures blits of step arrows that are already cached
+            foreach(RangeLineEditBase* lineEdit, m_benchmarkLineEdits){
+
+                lineEdit->render(&renderTarget);
+
+            }
+
+            QElapsedTimer timer;
+            timer.start();
+
+            for(int round = 0; round < repaintRounds; ++round){
+
+                foreach(RangeLineEditBase* lineEdit, m_benchmarkLineEdits){
+
+                    lineEdit->render(&renderTarget);
+
+                }
+
+            }
+
+            return static_cast<double>(timer.nsecsElapsed()) / (repaintRounds * m_benchmarkLineEdits.size());
+
+        };
+
+#ifndef QT_NO_DEBUG
+        //The same grid repainted with every step arrow filled again, the way each repaint did before the arrows were cached
+        RangeLineEditBase::setStepArrowCacheEnabled(false);
+        const double uncachedNanoseconds = nanosecondsPerRepaint();
+        RangeLineEditBase::setStepArrowCacheEnabled(true);
+        const double cachedNanoseconds   = nanosecondsPerRepaint();
+
+        repaintBenchmarkLabel->setText(QString("Uncached: %1 µs per repaint, Cached: %2 µs per repaint (%3 editors x %4 rounds)").arg(uncachedNanoseconds / 1000.0, 0, 'f', 2)
+                                                                                                                             .arg(cachedNanoseconds   / 1000.0, 0, 'f', 2)
+                                                                                                                             .arg(m_benchmarkLineEdits.size())
+                                                                                                                             .arg(repaintRounds));
+#else
+        const double cachedNanoseconds = nanosecondsPerRepaint();
+
+        repaintBenchmarkLabel->setText(QString("Cached: %1 µs per repaint (%2 editors x %3 rounds, the uncached repaint can only be timed in a debug build)").arg(cachedNanoseconds / 1000.0, 0, 'f', 2)
+                                                                                                                                                         .arg(m_benchmarkLineEdits.size())
+                                                                                                                                                         .arg(repaintRounds));
+#endif
+
+    }, Qt::DirectConnection);
+
+    connect(runHoverSweepButton, &QPushButton::clicked, this, [this](){
+
+        if(m_hoverSweepTimer->isActive() == false){
+
+            populateBenchmarkGrid(40, 50);
+
+            m_hoverSweepStep         = 0;
+            m_hoverSweepEventCount   = 0;
+            m_hoverSweepRepaintCount = 0;
+            m_hoverSweepCrossedLineEdits.clear();
+
+            m_hoverSweepClock.start();
+            m_hoverSweepTimer->start(1);
+
+        }
+
+    }, Qt::DirectConnection);
+
+    //Production::Note: The pointer really is moved, so Qt delivers the same enter, leave, move and hover events it would for a user's mouse
+    connect(m_hoverSweepTimer, &QTimer::timeout, this, [this, benchmarkScrollArea, hoverSweepLabel](){
+
+        const int stepPixels(8);
+
+        //Sweep back and forth along the middle of every row of editors, not just the ones in the viewport
+        QWidget*  gridWidget  = benchmarkScrollArea->widget();
+        const int stepsPerRow = std::max(1, gridWidget->width() / stepPixels);
+        const int rowCount    = m_benchmarkLineEdits.size() / m_benchmarkColumnCount;
+
+        if(m_hoverSweepStep < stepsPerRow * rowCount){
+
+            const int row    = m_hoverSweepStep / stepsPerRow;
+            const int column = (row % 2 == 0) ? (m_hoverSweepStep % stepsPerRow) : (stepsPerRow - 1 - m_hoverSweepStep % stepsPerRow);
+            const QPoint point(column * stepPixels + stepPixels / 2, m_benchmarkLineEdits.at(row * m_benchmarkColumnCount)->geometry().center().y());
+
+            //Production::Note: Scrolled before every move, so the pointer lands on the editor at point. The repaints scrolling causes are counted too
+            benchmarkScrollArea->ensureVisible(point.x(), point.y());
+            QCursor::setPos(gridWidget->mapToGlobal(point));
+            ++m_hoverSweepStep;
+
+        }else{
+
+            m_hoverSweepTimer->stop();
+
+            const double seconds = m_hoverSweepClock.nsecsElapsed() / 1000000000.0;
+
+            hoverSweepLabel->setText(QString("%1 events/s, %2 repaints/s (%3 events and %4 repaints over %5 s, %6 of %7 editors crossed)").arg(m_hoverSweepEventCount   / seconds, 0, 'f', 0)
+                                                                                                                                           .arg(m_hoverSweepRepaintCount / seconds, 0, 'f', 0)
+                                                                                                                                           .arg(m_hoverSweepEventCount)
+                                                                                                                                           .arg(m_hoverSweepRepaintCount)
+                                                                                                                                           .arg(seconds, 0, 'f', 2)
+                                                                                                                                           .arg(m_hoverSweepCrossedLineEdits.size())
+                                                                                                                                           .arg(m_benchmarkLineEdits.size()));
+
+        }
+
+    }, Qt::DirectConnection);
+
+    m_tabWidget->addTab(m_benchmarkWidget, "Benchmark");
+
+}
+
+void MainWindow::populateBenchmarkGrid(int rowCount, int columnCount){
+
+    //The grid is only built when a benchmark first needs it, so it doesn't slow down starting the demo
+    if(m_benchmarkLineEdits.size() == rowCount * columnCount && m_benchmarkColumnCount == columnCount){
+
+        return;
+
+    }
+
+    qDeleteAll(m_benchmarkLineEdits);
+    m_benchmarkLineEdits.clear();
+    m_benchmarkColumnCount = columnCount;
+
+    const int lineEditCount = rowCount * columnCount;
+    for(int i = 0; i < lineEditCount; ++i){
+
+        LatitudeLineEdit* latitudeLineEdit = new LatitudeLineEdit(nullptr, 4);
+        latitudeLineEdit->setValue(-90.0 + (180.0 * i) / lineEditCount);
+        latitudeLineEdit->installEventFilter(this);
+
+        m_benchmarkGridLayout->addWidget(latitudeLineEdit, i / columnCount, i % columnCount);
+        m_benchmarkLineEdits << latitudeLineEdit;
+
+    }
+
+    m_benchmarkGridLayout->activate();
+
+}
+
+bool MainWindow::eventFilter(QObject* watched, QEvent* event){
+
+    //Only counts while a hover sweep is running, the events still go on to the editors as usual
+    if(m_hoverSweepTimer != nullptr && m_hoverSweepTimer->isActive()){
+
+        switch(event->type()){
+
+            case QEvent::Enter:
+                m_hoverSweepCrossedLineEdits.insert(watched);
+                ++m_hoverSweepEventCount;
+                break;
+
+            case QEvent::MouseMove:
+            case QEvent::HoverMove:
+            case QEvent::HoverEnter:
+            case QEvent::HoverLeave:
+            case QEvent::Leave:
+                ++m_hoverSweepEventCount;
+                break;
+
+            case QEvent::Paint:
+                ++m_hoverSweepRepaintCount;
+                break;
+
+            default:
+                break;
+
+        }
+
+    }
+
+    return QMainWindow::eventFilter(watched, event);
+
+}
+
 MainWindow::~MainWindow(){
 
     /* NOP */
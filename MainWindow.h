@@ -3,6 +3,13 @@
 
 #include <QMainWindow>
 #include <QTabWidget>
+#include <QList>
+#include <QSet>
+#include <QElapsedTimer>
+
+class QGridLayout;
+class QTimer;
+class RangeLineEditBase;
 
 class MainWindow : public QMainWindow{
 
@@ -18,12 +25,30 @@ public:
 
     void setupPhoneWidget();
 
+    void setupBenchmarkWidget();
+
+    void populateBenchmarkGrid(int rowCount, int columnCount);
+
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
     ~MainWindow();
 
     QTabWidget* m_tabWidget;
     QWidget*    m_dmsWidget;
     QWidget*    m_doubleWidget;
     QWidget*    m_phoneWidget;
+    QWidget*    m_benchmarkWidget;
+
+    QGridLayout*              m_benchmarkGridLayout;
+    QList<RangeLineEditBase*> m_benchmarkLineEdits;
+    int                       m_benchmarkColumnCount;
+
+    QTimer*        m_hoverSweepTimer;
+    QElapsedTimer  m_hoverSweepClock;
+    int            m_hoverSweepStep;
+    qint64         m_hoverSweepEventCount;
+    qint64         m_hoverSweepRepaintCount;
+    QSet<QObject*> m_hoverSweepCrossedLineEdits;
 
 };
 
@@ -1,6 +1,6 @@
 #include "PhoneNumberLineEdit.h"
 #include "Ranges.h"
-#include "TrianglePaintedButton.h"
+#include "IntegerMath.h"
 
 #include <QKeyEvent>
 #include <QFocusEvent>
@@ -34,25 +34,25 @@ PhoneNumberLineEdit::PhoneNumberLineEdit(QWidget* parent, bool enableCountryCode
       m_4DigitCode        (nullptr)
 {
 
-    m_areaCode         = new RangeInt(999, 1, false);
-    m_areaCodeHyphen   = new RangeStringConstant("-");
-    m_3DigitCode       = new RangeInt(999, 1, false);
-    m_3DigitCodeHyphen = new RangeStringConstant("-");
-    m_4DigitCode       = new RangeInt(9999, 1, false);
+    PhoneNumberRangeLayout::build(m_rangePool, m_ranges);
+
+    m_areaCode         = PhoneNumberRangeLayout::at<0>(m_ranges);
+    m_areaCodeHyphen   = PhoneNumberRangeLayout::at<1>(m_ranges);
+    m_3DigitCode       = PhoneNumberRangeLayout::at<2>(m_ranges);
+    m_3DigitCodeHyphen = PhoneNumberRangeLayout::at<3>(m_ranges);
+    m_4DigitCode       = PhoneNumberRangeLayout::at<4>(m_ranges);
 
-    m_ranges << m_areaCode << m_areaCodeHyphen << m_3DigitCode << m_3DigitCodeHyphen << m_4DigitCode;
     m_prevCursorPosition = 0;
     syncRangeEdges();
 
     //Essentially the max phone number, without the country code
-    m_maxAllowableValue = 9999999999;
+    m_maxAllowableValue = PhoneNumberRangeLayout::maximumWholeValue();
     PhoneNumberLineEdit::enableCountryCode(enableCountryCode, countryCodeRangeSigFigs);
 
     setCursorPosition(0);
-    setMinimumWidth(QFontMetrics(font()).horizontalAdvance(text()) + m_incrementButton->width());
+    setMinimumWidth(QFontMetrics(font()).horizontalAdvance(text()) + STEP_BUTTON_MAXIMUM_WIDTH);
 
-    m_incrementButton->hide();
-    m_decrementButton->hide();
+    setStepButtonsVisible(false);
 
 }
 
@@ -69,7 +69,8 @@ void PhoneNumberLineEdit::setValue(QString value){
 
     if(canConvertToLongLong){
 
-        const QString originalValue = PhoneNumberLineEdit::value();
+        //Production::Note: Everything below is rendered once, and valueChanged emitted at most once, when this scope ends
+        BatchUpdate batch(this);
 
         //Need to convert the value to a string, ensure it conforms to out country code rules (if applicable) and then
         //split the value based on assumptions of how phone numbers are represented
@@ -95,52 +96,26 @@ void PhoneNumberLineEdit::setValue(QString value){
         //So long as all preconditions are met, we can attempt to split the string up and assign the values to each Range properly
         if(valueStr.length() <= expectedTotalLength){
 
-            //If the user set the value with something missing sig figs, we assume we zero out the left-most missing
-            //values to make the string the appropriate length
-            valueStr = valueStr.prepend(QString("0").repeated(expectedTotalLength - valueStr.length()));
-
-            int curInd = 0;
+            //Production::Note: Reading the digits as one number and splitting it by each Range's radix is the same as cutting the
+            //string into each Range's digits (missing left-most digits become zeroes), without building a substring per Range
+            const unsigned long long digits          = valueStr.toULongLong();
+            const unsigned long long localNumberSize = static_cast<unsigned long long>(PhoneNumberRangeLayout::maximumWholeValue()) + 1ULL;
 
-            //Let's go from left to right, starting with the country code (if applicable)
+            //The country code (if applicable) is whatever is left to the left of the local number, and sits in front of the static layout
+            int layoutStart = 0;
             if(m_countryCode != nullptr){
 
-                m_countryCode->setValue(valueStr.mid(curInd, m_countryCode->rangeLength()).toLongLong());
-                curInd += m_countryCode->rangeLength();
+                m_countryCode->setValue(static_cast<long long>(digits / localNumberSize));
+                layoutStart = m_ranges.indexOf(m_areaCode);
 
             }
 
-            //Area code
-            m_areaCode->setValue(valueStr.mid(curInd, m_areaCode->rangeLength()).toLongLong());
-            curInd += m_areaCode->rangeLength();
-
-            //3 digit code
-            m_3DigitCode->setValue(valueStr.mid(curInd, m_3DigitCode->rangeLength()).toLongLong());
-            curInd += m_3DigitCode->rangeLength();
-
-            //4 digit code
-            m_4DigitCode->setValue(valueStr.mid(curInd, m_4DigitCode->rangeLength()).toLongLong());
+            PhoneNumberRangeLayout::decomposeWholeValue(digits % localNumberSize, m_ranges, layoutStart);
 
         }
 
-        const QString originalString = text();
         scrapeDirtiedRanges(true);
 
-        //If our underlying precision changed, but we can't display the visual change, the text wouldn't have changed
-        //during the calls to the above two functions. As a result, we'd erroneously not emit our value changed,
-        //so if we changed something the user can't see, we still want to emit the signal properly, but ensure we don't blindly
-        //double emit valueChanged for no reason.
-        if(originalString == text()){
-
-           const QString newValue = PhoneNumberLineEdit::value();
-
-           if(originalValue != newValue){
-
-               emit valueChanged(newValue);
-
-           }
-
-        }
-
     }
 
 }
@@ -164,7 +139,7 @@ bool PhoneNumberLineEdit::enableCountryCode(bool enableCountryCode, int countryC
     bool successful(true);
 
     //Only valid if they want to enable a country code with valid sig figs OR they want to turn off country code (ignore sig figs)
-    if( (enableCountryCode == true && countryCodeRangeSigFigs > 0) || (enableCountryCode == false)){
+    if( (enableCountryCode == true && countryCodeRangeSigFigs > 0 && countryCodeRangeSigFigs <= MAX_POW10_LL_EXPONENT) || (enableCountryCode == false)){
 
         m_countryCodeEnabled = enableCountryCode;
 
@@ -174,8 +149,8 @@ bool PhoneNumberLineEdit::enableCountryCode(bool enableCountryCode, int countryC
            //Only allocate memory if we have to
            if(m_countryCode == nullptr && m_countryCodeHyphen == nullptr){
 
-                m_countryCode       = new RangeInt(std::pow(10LL, countryCodeRangeSigFigs) - 1LL, 1LL, false);
-                m_countryCodeHyphen = new RangeStringConstant("-");
+                m_countryCode       = m_rangePool.create<RangeInt>(pow10LL(countryCodeRangeSigFigs) - 1LL, 1LL, false);
+                m_countryCodeHyphen = m_rangePool.create<RangeStringConstant>(QStringLiteral("-"));
 
                 m_ranges.prepend(m_countryCodeHyphen);
                 m_ranges.prepend(m_countryCode);
@@ -183,7 +158,7 @@ bool PhoneNumberLineEdit::enableCountryCode(bool enableCountryCode, int countryC
            }else if(m_countryCode != nullptr && m_countryCodeHyphen != nullptr){
 
                //In case the user was just changing the sig figs, but the country code was already enabled
-               m_countryCode->setRange(std::pow(10LL, countryCodeRangeSigFigs) - 1LL);
+               m_countryCode->setRange(pow10LL(countryCodeRangeSigFigs) - 1LL);
 
            }
 
@@ -197,14 +172,17 @@ bool PhoneNumberLineEdit::enableCountryCode(bool enableCountryCode, int countryC
             //Pop the country code hyphen off
             m_ranges.pop_front();
 
-            delete m_countryCode;
-            delete m_countryCodeHyphen;
+            m_rangePool.destroy(m_countryCode);
+            m_rangePool.destroy(m_countryCodeHyphen);
 
             m_countryCode       = nullptr;
             m_countryCodeHyphen = nullptr;
 
         }
 
+        //The lists must match m_ranges before clearText() walks the RangeInts
+        syncRangeLists();
+
         clearText();
         syncRangeEdges();
 
@@ -252,7 +230,7 @@ void PhoneNumberLineEdit::showContextMenu(const QPoint& pos){
         QString clipboardText = QGuiApplication::clipboard()->text();
         clipboardText = clipboardText.remove(QRegExp("[^a-zA-Z\\d\\s]"));
         clipboardText.toLongLong(&canConvertToLongLong);
-        m_pasteAsValueFromClipBoardAction->setEnabled(canConvertToLongLong);
+        sharedContextMenu().m_pasteAsValueFromClipBoardAction->setEnabled(canConvertToLongLong);
 
     }
 
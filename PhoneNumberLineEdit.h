@@ -2,6 +2,14 @@
 #define PHONENUMBERLINEEDIT_H
 
 #include "RangeLineEdit.h"
+#include "StaticRangeLayout.h"
+
+//The fixed ###-###-#### part of a PhoneNumberLineEdit's layout (the country code is prepended at runtime by enableCountryCode(...))
+typedef StaticRangeLayout<StaticRange::Int<999,  1, false>,
+                          StaticRange::Const<u'-'>,
+                          StaticRange::Int<999,  1, false>,
+                          StaticRange::Const<u'-'>,
+                          StaticRange::Int<9999, 1, false>> PhoneNumberRangeLayout;
 
 /*! class PositionalLineEdit
  *
@@ -96,6 +104,15 @@ protected slots:
 
     }
 
+    /*
+     * Deprecated ability to step this widget, i.e. by the mouse wheel
+     */
+    void stepActiveIndexBy(long long) override{
+
+        /* NOP */
+
+    }
+
     /*
      * Deprecated ability to set precision for this widget
      */
@@ -1,6 +1,5 @@
 #include "PositionalLineEdit.h"
 #include "Ranges.h"
-#include "TrianglePaintedButton.h"
 
 #include <QKeyEvent>
 #include <QFocusEvent>
@@ -43,6 +42,8 @@ PositionalLineEdit::PositionalLineEdit(QWidget* parent)
  */
 bool PositionalLineEdit::setValueForIndex(const QChar& value, int index){
 
+    BatchUpdate batch(this);
+
     bool successful(RangeLineEdit::setValueForIndex(value, index));
 
     if(successful){
@@ -61,10 +62,12 @@ bool PositionalLineEdit::setValueForIndex(const QChar& value, int index){
  */
 void PositionalLineEdit::setValue(double value){
 
-    const double originalValue = PositionalLineEdit::value();
+    //Production::Note: Everything below is rendered once, and valueChanged emitted at most once, when this scope ends
+    BatchUpdate batch(this);
 
     QChar signChar = value >= 0 ? m_degreeChar->m_positiveChar : m_degreeChar->m_negativeChar;
     m_degreeChar->m_value = signChar;
+    m_degreeChar->m_dirty = true;
 
     value = std::fabs(value);
 
@@ -74,91 +77,12 @@ void PositionalLineEdit::setValue(double value){
 
     }
 
-    double degrees                    = std::floor(value);
-    double minutesNotTruncated        = (value - degrees) * 60.0;
-    double minutes                    = std::floor(minutesNotTruncated);
-    double secondsNotTruncated        = (minutesNotTruncated - minutes) * 60.0;
-    double seconds                    = std::floor(secondsNotTruncated);
-    double decimalSecondsNotTruncated = 0.0;
-    double decimalSeconds             = 0.0;
-
-    if(m_decimalRange != nullptr){
-
-        //Production::Note: m_decimalRange->m_range == std::pow(10LL, m_decimals) - 1LL, so we need to divide cleanly by 10, 100, 1000, etc., not 9, 99, 999
-        decimalSecondsNotTruncated = (secondsNotTruncated - seconds) * (m_decimalRange->m_range + 1.0L);
-        decimalSeconds             = std::floor(decimalSecondsNotTruncated);
-
-    }
-
-    minutes        = std::floor(minutes);
-    seconds        = std::floor(seconds);
-    decimalSeconds = std::floor(decimalSeconds);
-
-    m_degreeInt->m_value  = degrees;
-    m_minuteInt->m_value  = minutes;
-    m_secondsInt->m_value = seconds;
-
-    long double minimumDecimalValue(1.0L / m_secondsInt->divisor());
-
-    //If the user hasn't specified decimals, we need to ignore its value in determining precision loss
-    if(m_decimalRange != nullptr){
-
-        m_decimalRange->m_value = decimalSeconds;
-
-        //Production::Note: The below episolon scales with how many decimals are being used, so it's completely dynamic
-        minimumDecimalValue = (1.0L / (m_secondsInt->divisor() * (m_decimalRange->m_range + 1.0)));
-
-    }
-
-    //This may or may not include decimal values
-    m_undisplayedPrecision = value - sumRangeInts();
-
-    const double epsilonErrorAllowed(minimumDecimalValue / 10.0);
-    if(m_undisplayedPrecision > epsilonErrorAllowed){
-
-        //Production::Note: If we found enough error to be greater than the epsilon,
-        //that implies we SHOULD have incremented one more time,
-        //but because doubles and floats are sometimes imprecise during arithmetic operations with certain values,
-        //it erroneously floored an extra decimal value.
-        //If we can increment the decimal range it should fix up any visual desync occurring from being off by 1 decimal.
-        if((m_decimalRange != nullptr && m_decimalRange->increment(0)) || m_secondsInt->increment(0)){
-
-            if(value >= 0){
-
-                //We also need to remove from the undisplayed precision the amount we were able to increment by (Brings is closer to 0)
-                m_undisplayedPrecision -= minimumDecimalValue;
-
-            }else{
-
-                m_undisplayedPrecision += minimumDecimalValue;
-
-            }
-
-        }
-
-    }
-
-    const QString originalString = text();
+    //The RangeInts hold the value as an exact count of the smallest displayed unit, anything finer is kept as undisplayed precision
+    m_undisplayedPrecision = value - setRangeIntMagnitudes(value);
 
     syncRangeSigns();
     maximumExceededFixup();
 
-    //If our underlying precision changed, but we can't display the visual change, the text wouldn't have changed
-    //during the calls to the above two functions. As a result, we'd erroneously not emit our value changed,
-    //so if we changed something the user can't see, we still want to emit the signal properly, but ensure we don't blindly
-    //double emit valueChanged for no reason.
-    if(originalString == text()){
-
-       const double newValue = PositionalLineEdit::value();
-
-       if(originalValue != newValue){
-
-           emit valueChanged(newValue);
-
-       }
-
-    }
-
 }
 
 /*
@@ -205,54 +129,40 @@ void PositionalLineEdit::clearCurrentValidators(){
 }
 
 /*
- * Attempts to increment the Range at the current cursor index, resets undisplayed precision to 0 if the text changed
+ * Calls base class implementation, and resets undisplayed precision to 0 if any Range changed
  */
-void PositionalLineEdit::increment(){
+bool PositionalLineEdit::stepBy(long long steps, int charIndex){
 
-    const QString prevText(text());
+    //Batched, so valueChanged is emitted after the undisplayed precision is dropped, not before
+    BatchUpdate batch(this);
 
-    RangeLineEdit::increment();
+    const bool stepped = RangeLineEdit::stepBy(steps, charIndex);
 
-    if(prevText != text()){
+    if(stepped){
 
         m_undisplayedPrecision = 0.0;
 
     }
 
+    return stepped;
+
 }
 
 /*
- * Attempts to decrement the Range at the current cursor index, resets undisplayed precision to 0 if the text changed
+ * Resets undisplayed precision to 0, since the value was clamped to exactly the maximum allowable value
  */
-void PositionalLineEdit::decrement(){
-
-    const QString prevText(text());
-
-    RangeLineEdit::decrement();
+void PositionalLineEdit::maximumWasExceeded(){
 
-    if(prevText != text()){
-
-        m_undisplayedPrecision = 0.0;
-
-    }
+    m_undisplayedPrecision = 0.0;
 
 }
 
 /*
- * Helper function that ensures any changes to the value of a Range will not exceed the maximum allowable set value.
- * If the maximum is exceeded, the first-most RangeInt will be set to its range and all subsequent RangeInts will be zeroed out.
+ * Returns the undisplayed precision, so a BatchUpdate that only changed it still emits valueChanged
  */
-void PositionalLineEdit::maximumExceededFixup(){
-
-    const QString prevText(text());
+long double PositionalLineEdit::undisplayedPrecision() const{
 
-    RangeLineEdit::maximumExceededFixup();
-
-    if(prevText != text()){
-
-        m_undisplayedPrecision = 0.0;
-
-    }
+    return m_undisplayedPrecision;
 
 }
 
@@ -267,7 +177,7 @@ void PositionalLineEdit::showContextMenu(const QPoint& pos){
 
         bool canConvertToDecimal(false);
         QGuiApplication::clipboard()->text().toDouble(&canConvertToDecimal);
-        m_pasteAsValueFromClipBoardAction->setEnabled(canConvertToDecimal);
+        sharedContextMenu().m_pasteAsValueFromClipBoardAction->setEnabled(canConvertToDecimal);
 
     }
 
@@ -325,6 +235,8 @@ void PositionalLineEdit::valueChangedPrivate(){
  */
 void PositionalLineEdit::clearText(){
 
+    BatchUpdate batch(this);
+
     RangeLineEdit::clearText();
 
     m_undisplayedPrecision = 0.0;
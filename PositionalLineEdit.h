@@ -2,6 +2,22 @@
 #define POSITIONALLINEEDIT_H
 
 #include "RangeLineEdit.h"
+#include "StaticRangeLayout.h"
+
+/*
+ * The fixed D°M'S'' part of a PositionalLineEdit's layout (decimals are appended at runtime by setPrecision(...))
+ * @PARAM NegativeChar - The sign's negative character (i.e. 'S' or 'W')
+ * @PARAM PositiveChar - The sign's positive character (i.e. 'N' or 'E')
+ * @PARAM DegreeRange  - The maximum degree (i.e. 90 or 180)
+ */
+template <char16_t NegativeChar, char16_t PositiveChar, long long DegreeRange>
+using PositionalRangeLayout = StaticRangeLayout<StaticRange::SignChar<NegativeChar, PositiveChar>,
+                                                StaticRange::Int<DegreeRange, 1>,
+                                                StaticRange::Const<u'°'>,
+                                                StaticRange::Int<59, 60>,
+                                                StaticRange::Const<u'\''>,
+                                                StaticRange::Int<59, 3600>,
+                                                StaticRange::Const<u'\'', u'\''>>;
 
 /*! class PositionalLineEdit
  *
@@ -29,6 +45,13 @@ public:
      */
     bool setValueForIndex(const QChar& value, int index) override;
 
+    /*
+     * Calls base class implementation, and resets undisplayed precision to 0 if any Range changed
+     * @PARAM long long steps     - How many units to step by, negative to step down
+     * @PARAM int       charIndex - The index of the digit to step
+     */
+    bool stepBy(long long steps, int charIndex) override;
+
     /*
      * Force the specialized parameratized subclass to have to define how its underling Ranges should be converted to some usable value
      * This mimics Qt'isms where their widgets that have a value, normally have a callable T::value().
@@ -51,20 +74,34 @@ protected:
     void clearCurrentValidators() override;
 
     /*
-     * Attempts to increment the Range at the current cursor index, resets undisplayed precision to 0 if the text changed
+     * Resets undisplayed precision to 0, since the value was clamped to exactly the maximum allowable value
      */
-    void increment() override;
+    void maximumWasExceeded() override;
 
     /*
-     * Attempts to decrement the Range at the current cursor index, resets undisplayed precision to 0 if the text changed
+     * Returns the undisplayed precision, so a BatchUpdate that only changed it still emits valueChanged
      */
-    void decrement() override;
+    long double undisplayedPrecision() const override;
 
     /*
-     * Helper function that ensures any changes to the value of a Range will not exceed the maximum allowable set value.
-     * If the maximum is exceeded, the first-most RangeInt will be set to its range and all subsequent RangeInts will be zeroed out.
+     * Creates the Ranges of a PositionalRangeLayout and assigns the typed members from it
      */
-    void maximumExceededFixup();
+    template <typename Layout>
+    void buildLayout(){
+
+        static_assert(Layout::unitWeight(1) == 3600 && Layout::unitWeight(3) == 60, "PositionalLineEdit expects a D°M'S'' layout");
+
+        Layout::build(m_rangePool, m_ranges);
+
+        m_degreeChar   = Layout::template at<0>(m_ranges);
+        m_degreeInt    = Layout::template at<1>(m_ranges);
+        m_degreeSymbol = Layout::template at<2>(m_ranges);
+        m_minuteInt    = Layout::template at<3>(m_ranges);
+        m_minuteSymbol = Layout::template at<4>(m_ranges);
+        m_secondsInt   = Layout::template at<5>(m_ranges);
+        m_secondSymbol = Layout::template at<6>(m_ranges);
+
+    }
 
 protected slots:
 
@@ -0,0 +1,8 @@
+#include "RangeLineEdit.h"
+
+/*
+ * The value types used by this project, compiled once here rather than in every file that includes RangeLineEdit.h
+ */
+template class RangeLineEdit<double>;
+template class RangeLineEdit<long double>;
+template class RangeLineEdit<QString>;
@@ -14,8 +14,10 @@ SOURCES += \
     LongitudeLineEdit.cpp \
     PhoneNumberLineEdit.cpp \
     PositionalLineEdit.cpp \
+    RangeLineEdit.cpp \
+    RangeLineEditBase.cpp \
+    RangePool.cpp \
     Ranges.cpp \
-    TrianglePaintedButton.cpp \
     main.cpp \
     MainWindow.cpp
 
@@ -26,9 +28,12 @@ HEADERS += \
     MainWindow.h \
     PhoneNumberLineEdit.h \
     PositionalLineEdit.h \
+    IntegerMath.h \
     RangeLineEdit.h \
+    RangeLineEditBase.h \
+    RangePool.h \
     Ranges.h \
-    TrianglePaintedButton.h
+    StaticRangeLayout.h
 
 # Default rules for deployment.
 qnx: target.path = /tmp/$${TARGET}/bin
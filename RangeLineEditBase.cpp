@@ -0,0 +1,2033 @@
+#include "RangeLineEditBase.h"
+#include "Ranges.h"
+#include "IntegerMath.h"
+
+#include <QKeyEvent>
+#include <QTimerEvent>
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QPixmapCache>
+#include <QResizeEvent>
+#include <QStyle>
+#include <QStyleOptionButton>
+#include <QWheelEvent>
+#include <QMenu>
+#include <QAction>
+#include <QClipboard>
+#include <QCoreApplication>
+#include <QGuiApplication>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+constexpr int RangeLineEditBase::STEP_BUTTON_MINIMUM_WIDTH;
+constexpr int RangeLineEditBase::STEP_BUTTON_MAXIMUM_WIDTH;
+constexpr int RangeLineEditBase::WHEEL_ANGLE_PER_STEP;
+constexpr int RangeLineEditBase::WHEEL_PIXELS_PER_STEP;
+constexpr int RangeLineEditBase::WHEEL_FRAME_INTERVAL_MS;
+constexpr int RangeLineEditBase::WHEEL_ACCELERATION_WINDOW_MS;
+constexpr int RangeLineEditBase::WHEEL_ACCELERATION_RAMP;
+constexpr int RangeLineEditBase::WHEEL_MAXIMUM_ACCELERATION;
+constexpr int RangeLineEditBase::AUTO_REPEAT_DELAY_MS;
+constexpr int RangeLineEditBase::AUTO_REPEAT_INTERVAL_MS;
+constexpr int RangeLineEditBase::AUTO_REPEAT_DECADE_MS;
+constexpr int RangeLineEditBase::AUTO_REPEAT_MAXIMUM_DECADES;
+
+/* --- Public methods --- */
+
+/*
+ * Value Constructor
+ */
+RangeLineEditBase::RangeLineEditBase(QWidget* parent)
+    : QLineEdit               (parent),
+      m_batchStartPrecision   (0.0L),
+      m_rangePool             (),
+      m_ranges                ({}),
+      m_rangeInts             ({}),
+      m_rangeChar             (nullptr),
+      m_cursorMap             ({}),
+      m_nonZeroRangeInts      (0ULL),
+      m_negativeRangeInts     (0ULL),
+      m_valueRevision         (1ULL),
+      m_sumRangeIntsRevision  (0ULL),
+      m_sumRangeIntsCache     (0.0L),
+      m_textBuffer            (),
+      m_batchDepth            (0),
+      m_batchPendingFixups    (false),
+      m_batchPendingScrape    (false),
+      m_batchPendingFullScrape(false),
+      m_batchFlushing         (false),
+      m_decimals              (-1),
+      m_maxAllowableValue     (0LL),
+      m_prevCursorPosition    (0),
+      m_stepButtonsVisible    (true),
+      m_incrementButtonRect   (),
+      m_decrementButtonRect   (),
+      m_hoveredStepButton     (NO_STEP_BUTTON),
+      m_pressedStepButton     (NO_STEP_BUTTON),
+      m_wheelAngleRemainder   (0),
+      m_wheelPixelRemainder   (0),
+      m_pendingWheelSteps     (0LL),
+      m_wheelStreak           (0),
+      m_wheelClock            (),
+      m_wheelFrameTimer       (),
+      m_autoRepeatTimer       (),
+      m_autoRepeatClock       (),
+      m_incrementArrowKey     (),
+      m_decrementArrowKey     (),
+      m_stepArrowKeySize      (),
+      m_stepArrowKeyDpr       (0.0),
+      m_stepArrowKeyColor     (0u),
+      m_decimalString         (nullptr),
+      m_decimalRange          (nullptr),
+      m_highlightColor        (QColor(128, 128, 128, 75)),
+      m_charOffsets           (),
+      m_charAdvances          (),
+      m_charHeight            (0),
+      m_charOffsetsDirty      (true),
+      m_highlightRect         ()
+{
+
+    //Production::Note: Mouse tracking is only needed to know when a step button is hovered, so it's turned off along with them.
+    //Qt::WA_Hover isn't set, it would repaint the whole widget whenever the pointer entered or left it
+    setMouseTracking(m_stepButtonsVisible);
+    createCustomContextMenu();
+
+    connect(this, &RangeLineEditBase::cursorPositionChanged,      this, &RangeLineEditBase::cursorPositionChangedEvent, Qt::DirectConnection);
+    connect(this, &RangeLineEditBase::selectionChanged,           this, &RangeLineEditBase::selectionChangedEvent,      Qt::DirectConnection);
+    connect(this, &RangeLineEditBase::customContextMenuRequested, this, &RangeLineEditBase::showContextMenu,            Qt::DirectConnection);
+    connect(this, &RangeLineEditBase::textChanged,                this, &RangeLineEditBase::valueModified,              Qt::DirectConnection);
+
+}
+
+/*
+ * Destructor.
+ * Clears all Range validators.
+ */
+RangeLineEditBase::~RangeLineEditBase(){
+
+    clearCurrentValidators();
+
+}
+
+/*
+ * Convenience function for dynamically changing the precision of the decimals.
+ * The decimal Range is retargeted in place, and the current value is re-expressed at the new precision,
+ * so the text is updated (and textChanged and valueModified emitted) at most once.
+ */
+void RangeLineEditBase::setPrecision(int decimals){
+
+    if(decimals > MAX_POW10_LL_EXPONENT){
+
+        std::cerr << QString("Error. Precision: %1 exceeds the maximum representable precision: %2").arg(decimals).arg(MAX_POW10_LL_EXPONENT).toStdString() << std::endl;
+        return;
+
+    }
+
+    if(decimals < 0 || decimals == m_decimals || (decimals == 0 && m_decimalRange == nullptr)){
+
+        return;
+
+    }
+
+    //The decimal divisor stacks on top of the RangeInt to its left, so reject precisions whose divisor can't fit in a long long
+    long long decimalDivisor = 1LL;
+    if(checkedMultiply(pow10LL(decimals), precisionBaseDivisor(), decimalDivisor) == false){
+
+        std::cerr << QString("Error. Precision: %1 overflows the decimal divisor").arg(decimals).toStdString() << std::endl;
+        return;
+
+    }
+
+    const int currentCursorPos = this->cursorPosition();
+
+    {
+
+        BatchUpdate batch(this);
+        applyPrecisionPreservingValue(decimals, decimalDivisor);
+
+    }
+
+    //Production::Note: The text changed length, so QLineEdit::setText(...) moved the cursor to the end
+    setCursorPosition(currentCursorPos);
+
+}
+
+/*
+ * Delegates a call to the proper Range for the given index to call its own Range::setValueForIndex(...)
+ */
+bool RangeLineEditBase::setValueForIndex(const QChar& value, int index){
+
+    bool valueWasSet = false;
+    ::Range* range = getRangeForIndex(index);
+    if(range != nullptr){
+
+        valueWasSet = range->setValueForIndex(value, index - range->m_charIndexStart);
+        if(valueWasSet){
+
+            syncRangeSigns();
+            maximumExceededFixup();
+            scrapeDirtiedRanges();
+            setCursorPosition(index);
+
+        }
+
+    }
+
+    return valueWasSet;
+
+}
+
+/*
+ * Steps the Range at charIndex by steps units of the digit displayed there, carrying, borrowing and clamping in one pass.
+ * However large steps is, the text is updated once and valueChanged is emitted at most once.
+ * Returns true if any Range changed.
+ */
+bool RangeLineEditBase::stepBy(long long steps, int charIndex){
+
+    bool stepped(false);
+
+    //Check if this position belongs to a valid Range
+    if(charIndex >= 0 && charIndex < m_cursorMap.size() && m_cursorMap.at(charIndex).m_editable){
+
+        const CursorMapEntry& entry = m_cursorMap.at(charIndex);
+
+        {
+
+            //The sign and maximum fixups scrape on their own, so they're batched into the one scrape of the step
+            BatchUpdate batch(this);
+
+            stepped = entry.m_range->stepBy(steps, entry.m_localIndex);
+            if(stepped){
+
+                syncRangeSigns();
+                maximumExceededFixup();
+                scrapeDirtiedRanges();
+
+            }
+
+        }
+
+        if(stepped){
+
+            setCursorPosition(charIndex);
+
+        }
+
+    }
+
+    return stepped;
+
+}
+
+/*
+ * Convenience function for setting the current active index's color
+ */
+void RangeLineEditBase::setActiveIndexHighlightColor(const QColor& highlightColor, bool implicitlyMakeSemiTransparent){
+
+    if(highlightColor.isValid()){
+
+        m_highlightColor = highlightColor;
+
+        //This will make it so a user could, for example use Qt::red, Qt::blue, Qt::green, etc.,
+        //and it'll automatically make it semi-transparent without multiple lines of code on their part
+        if(implicitlyMakeSemiTransparent){
+
+            m_highlightColor.setAlpha(75);
+
+        }
+
+    }
+
+}
+
+/*
+ * Shows or hides the increment and decrement buttons painted on the right edge of this widget
+ */
+void RangeLineEditBase::setStepButtonsVisible(bool visible){
+
+    if(visible != m_stepButtonsVisible){
+
+        m_stepButtonsVisible = visible;
+        m_pressedStepButton  = NO_STEP_BUTTON;
+        m_autoRepeatTimer.stop();
+        setMouseTracking(visible);
+        setHoveredStepButton(NO_STEP_BUTTON);
+        update();
+
+    }
+
+}
+
+#ifndef QT_NO_DEBUG
+/*
+ * Debug builds only: turns the step arrow cache off or on for every RangeLineEdit in the process
+ */
+void RangeLineEditBase::setStepArrowCacheEnabled(bool enabled){
+
+    stepArrowCacheEnabled() = enabled;
+
+}
+#endif
+
+/* --- Protected methods --- */
+
+/*
+ * Changes the layout to display decimals digits of precision: retargets the decimal RangeInt in place if there already is one,
+ * and only adds or removes the decimal Ranges when the precision is turned on or off.
+ * The values held by the Ranges are left as they were, setPrecision(...) re-expresses the value afterwards.
+ * Overridden by subclasses that need to adjust other Ranges to the new precision.
+ */
+void RangeLineEditBase::applyPrecision(int decimals, long long decimalDivisor){
+
+    m_decimals = decimals;
+
+    //Only the width of the decimal RangeInt changes, so nothing to its left moves
+    if(decimals > 0 && m_decimalRange != nullptr){
+
+        m_decimalRange->setRange(pow10LL(m_decimals) - 1LL);
+        m_decimalRange->setDivisor(decimalDivisor);
+
+        syncRangeIndicesFrom(m_decimalRange);
+
+    }
+    //Generally this occurs if we're setting our type for the first time or changing our type dynamically
+    else if(decimals > 0){
+
+        m_decimalString = m_rangePool.create<RangeStringConstant>(QStringLiteral("."));
+        m_decimalRange  = m_rangePool.create<RangeInt>(pow10LL(m_decimals) - 1LL, decimalDivisor);
+
+        //Production::Note: If the final Range type in the current m_ranges list when initialized is a RangeStringConstant (i.e. a " '' "),
+        //then they are probably attempting to make the decimal apply to its closest RangeInt, so we want to pop the previous tail,
+        //append our new string constant for the decimal point and RangeInt for the decimals, then append the previous tail back on
+        ::Range* secondSymbol = nullptr;
+
+        //For example, we may have to pop something like " '' " from a seconds symbol off the back and move it to the right of the decimal ranges
+        if(m_ranges.empty() == false && m_ranges.last()->m_kind == ::Range::RANGE_STRING_CONSTANT){
+
+            secondSymbol = m_ranges.last();
+            m_ranges.pop_back();
+
+        }
+
+        m_ranges << m_decimalString << m_decimalRange;
+
+        //This is only optionally done if the above assumptions were true, otherwise we're directly appending our two new Range types for decimal representation
+        if(secondSymbol != nullptr){
+
+            m_ranges << secondSymbol;
+
+        }
+
+        syncRangeEdges();
+
+    }
+    //Handle removing and cleaning up the decimal range if it previously existed
+    else if(m_decimalRange != nullptr){
+
+        Range* currentTail = nullptr;
+
+        //Pop the Seconds String Constant, the decimal Range, and the decimal String Constant
+        if(m_ranges.isEmpty() == false && m_ranges.last()->m_kind == ::Range::RANGE_STRING_CONSTANT){
+
+            currentTail = m_ranges.last();
+            m_ranges.pop_back();
+
+        }
+
+        m_ranges.pop_back();
+        m_rangePool.destroy(m_decimalString);
+
+        m_ranges.pop_back();
+        m_rangePool.destroy(m_decimalRange);
+
+        m_decimalString = nullptr;
+        m_decimalRange  = nullptr;
+
+        if(currentTail != nullptr){
+
+            m_ranges << currentTail;
+
+        }
+
+        syncRangeEdges();
+
+    }
+
+}
+
+/*
+ * Returns the divisor of the least significant RangeInt other than the decimal one, which the decimal divisor stacks on top of
+ */
+long long RangeLineEditBase::precisionBaseDivisor(){
+
+    for(int i = m_rangeInts.size() - 1; i >= 0; --i){
+
+        if(m_rangeInts.at(i) != m_decimalRange){
+
+            return m_rangeInts.at(i)->m_divisor;
+
+        }
+
+    }
+
+    return 1LL;
+
+}
+
+/*
+ * Helper function for when a Range changed width without the layout changing otherwise (i.e. the decimal RangeInt after a precision change).
+ * Recomputes the start and end indices of that Range and every Range to its right, dirtying only those, then rebuilds the cursor map.
+ * The Ranges to its left keep their indices, so their text is still copied from the current text by the next scrape.
+ */
+void RangeLineEditBase::syncRangeIndicesFrom(::Range* range){
+
+    int curRangeOffset = (range->m_leftRange != nullptr) ? range->m_leftRange->m_charIndexEnd + 1 : 0;
+
+    for(::Range* rangeIter = range; rangeIter != nullptr; rangeIter = rangeIter->m_rightRange){
+
+        rangeIter->m_charIndexStart = curRangeOffset;
+        curRangeOffset += rangeIter->rangeLength();
+        rangeIter->m_charIndexEnd = curRangeOffset - 1;
+
+        rangeIter->m_dirty = true;
+
+    }
+
+    syncCursorMap();
+
+    scrapeDirtiedRanges();
+
+}
+
+/*
+ * Helper function for hit-testing the painted step buttons
+ */
+RangeLineEditBase::StepButton RangeLineEditBase::stepButtonAt(const QPoint& pos) const{
+
+    StepButton stepButton(NO_STEP_BUTTON);
+    if(m_stepButtonsVisible){
+
+        if(m_incrementButtonRect.contains(pos)){
+
+            stepButton = INCREMENT_STEP_BUTTON;
+
+        }else if(m_decrementButtonRect.contains(pos)){
+
+            stepButton = DECREMENT_STEP_BUTTON;
+
+        }
+
+    }
+
+    return stepButton;
+
+}
+
+/*
+ * Helper function for the rectangle of a step button, or an empty rectangle for NO_STEP_BUTTON
+ */
+QRect RangeLineEditBase::stepButtonRect(StepButton stepButton) const{
+
+    QRect rect;
+    if(stepButton == INCREMENT_STEP_BUTTON){
+
+        rect = m_incrementButtonRect;
+
+    }else if(stepButton == DECREMENT_STEP_BUTTON){
+
+        rect = m_decrementButtonRect;
+
+    }
+
+    return rect;
+
+}
+
+/*
+ * Helper function that keeps track of the step button under the mouse, repainting only when it changes.
+ * The cursor is an arrow over the buttons, rather than the text's I-beam.
+ */
+void RangeLineEditBase::setHoveredStepButton(StepButton stepButton){
+
+    if(stepButton != m_hoveredStepButton){
+
+        //Production::Note: This only changes this widget's cursor, so nothing is left behind on the application's override cursor stack
+        setCursor(stepButton == NO_STEP_BUTTON ? Qt::IBeamCursor : Qt::ArrowCursor);
+
+        update(stepButtonRect(m_hoveredStepButton));
+        update(stepButtonRect(stepButton));
+
+        m_hoveredStepButton = stepButton;
+
+        //The highlighted index is painted while a step button is hovered
+        updateHighlight();
+
+    }
+
+}
+
+/*
+ * Helper function that rebuilds each character's x-offset from the first one, if the text, font or style changed since they were last built
+ */
+void RangeLineEditBase::syncCharOffsets(){
+
+    if(m_charOffsetsDirty == false){
+
+        return;
+
+    }
+
+    const QString currentText = text();
+    QFontMetrics  fontMetrics(font());
+
+    m_charOffsets.resize(currentText.length() + 1);
+    m_charOffsets[0] = 0;
+
+    for(int i = 0; i < currentText.length(); ++i){
+
+        const QChar character = currentText.at(i);
+
+        int advance = m_charAdvances.value(character, -1);
+        if(advance < 0){
+
+            advance = fontMetrics.horizontalAdvance(character);
+            m_charAdvances.insert(character, advance);
+
+        }
+
+        m_charOffsets[i + 1] = m_charOffsets[i] + advance;
+
+    }
+
+    m_charHeight       = fontMetrics.height();
+    m_charOffsetsDirty = false;
+
+}
+
+/*
+ * Whether the highlight is painted at all: while this widget has focus, or a step button is hovered
+ */
+bool RangeLineEditBase::highlightVisible() const{
+
+    return this->hasFocus() || m_hoveredStepButton != NO_STEP_BUTTON;
+
+}
+
+/*
+ * Returns the highlight's rectangle around the character at the cursor, or an empty rectangle if the cursor is past the end of the text
+ */
+QRect RangeLineEditBase::highlightRect(){
+
+    syncCharOffsets();
+
+    QRect rect;
+
+    const int cursor = cursorPosition();
+    if(cursor < m_charOffsets.size() - 1){
+
+        const QRect caretRect = cursorRect();
+
+        //The caret's rectangle starts too far from the blinking caret (text cursor),
+        //so this offsets the x position properly to align with the blinking caret properly
+        QPoint topLeft(caretRect.x() + caretRect.width() / 2, caretRect.y());
+
+        int pixelsWide = m_charOffsets.at(cursor + 1) - m_charOffsets.at(cursor);
+
+        rect = QRect(topLeft, QPoint(topLeft.x() + pixelsWide - 1, topLeft.y() + m_charHeight));
+
+    }
+
+    return rect;
+
+}
+
+/*
+ * Helper function that repaints only where the highlight was last painted and where it is now, rather than the whole widget
+ */
+void RangeLineEditBase::updateHighlight(){
+
+    //The rectangles are grown by a pixel, since QPainter::drawRect(...) covers the right and bottom edges too
+    if(m_highlightRect.isNull() == false){
+
+        update(m_highlightRect.adjusted(-1, -1, 1, 1));
+
+    }
+
+    m_highlightRect = highlightVisible() ? highlightRect() : QRect();
+
+    if(m_highlightRect.isNull() == false){
+
+        update(m_highlightRect.adjusted(-1, -1, 1, 1));
+
+    }
+
+}
+
+/*
+ * Helper function used by paintEvent(...) to paint the step buttons as push button bevels with a triangle facing up or down
+ */
+void RangeLineEditBase::paintStepButtons(QPainter& painter){
+
+    QStyleOptionButton option;
+    option.initFrom(this);
+
+    const QColor arrowColor = palette().color(QPalette::ButtonText);
+
+    for(StepButton stepButton : {INCREMENT_STEP_BUTTON, DECREMENT_STEP_BUTTON}){
+
+        const QRect rect = stepButtonRect(stepButton);
+
+        option.rect  = rect;
+        option.state = QStyle::State_Enabled;
+        option.state |= (stepButton == m_pressedStepButton && stepButton == m_hoveredStepButton) ? QStyle::State_Sunken : QStyle::State_Raised;
+
+        if(stepButton == m_hoveredStepButton){
+
+            option.state |= QStyle::State_MouseOver;
+
+        }
+
+        style()->drawControl(QStyle::CE_PushButtonBevel, &option, &painter, this);
+
+#ifndef QT_NO_DEBUG
+        if(stepArrowCacheEnabled() == false){
+
+            painter.save();
+            painter.setRenderHint(QPainter::Antialiasing);
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(arrowColor);
+            painter.drawPolygon(stepArrowPolygon(stepButton, rect));
+            painter.restore();
+
+            continue;
+
+        }
+#endif
+
+        painter.drawPixmap(rect.topLeft(), stepArrowPixmap(stepButton, rect.size(), devicePixelRatioF(), arrowColor));
+
+    }
+
+}
+
+/*
+ * Returns the arrow of a step button rendered at size, from a pixmap cache shared by every RangeLineEdit in the process
+ */
+QPixmap RangeLineEditBase::stepArrowPixmap(StepButton stepButton, const QSize& size, qreal devicePixelRatio, const QColor& color){
+
+    //Production::Note: Formatting a key allocates, so it's only done again once the size, screen or palette changes, not on every repaint
+    if(size != m_stepArrowKeySize || devicePixelRatio != m_stepArrowKeyDpr || color.rgba() != m_stepArrowKeyColor){
+
+        const QString keySuffix = QString("_%1x%2_%3_%4").arg(size.width()).arg(size.height()).arg(devicePixelRatio).arg(color.rgba());
+
+        m_incrementArrowKey = QString("RangeLineEdit_stepArrow_%1").arg(static_cast<int>(INCREMENT_STEP_BUTTON)) + keySuffix;
+        m_decrementArrowKey = QString("RangeLineEdit_stepArrow_%1").arg(static_cast<int>(DECREMENT_STEP_BUTTON)) + keySuffix;
+        m_stepArrowKeySize  = size;
+        m_stepArrowKeyDpr   = devicePixelRatio;
+        m_stepArrowKeyColor = color.rgba();
+
+    }
+
+    const QString& key = (stepButton == INCREMENT_STEP_BUTTON) ? m_incrementArrowKey : m_decrementArrowKey;
+
+    QPixmap pixmap;
+    if(QPixmapCache::find(key, &pixmap) == false){
+
+        //Rendered at the screen's resolution, so the blit is 1:1 and the antialiasing stays crisp
+        pixmap = QPixmap(size * devicePixelRatio);
+        pixmap.setDevicePixelRatio(devicePixelRatio);
+        pixmap.fill(Qt::transparent);
+
+        QPainter painter(&pixmap);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(color);
+        painter.drawPolygon(stepArrowPolygon(stepButton, QRect(QPoint(0, 0), size)));
+        painter.end();
+
+        QPixmapCache::insert(key, pixmap);
+
+    }
+
+    return pixmap;
+
+}
+
+#ifndef QT_NO_DEBUG
+/*
+ * Debug builds only: whether paintStepButtons(...) blits the arrows from the cache
+ */
+bool& RangeLineEditBase::stepArrowCacheEnabled(){
+
+    static bool enabled(true);
+
+    return enabled;
+
+}
+#endif
+
+/*
+ * Helper function for the triangle of a step button's arrow within rect
+ */
+QPolygon RangeLineEditBase::stepArrowPolygon(StepButton stepButton, const QRect& rect){
+
+    QPolygon trianglePolygon;
+
+    if(stepButton == INCREMENT_STEP_BUTTON){
+
+        //Draw from bottom left, to middle top, to bottom right
+        trianglePolygon << QPoint(rect.x() + rect.width() * 0.20, rect.y() + rect.height() * 0.80);
+        trianglePolygon << QPoint(rect.x() + rect.width() / 2.0,  rect.y() + rect.height() * 0.20);
+        trianglePolygon << QPoint(rect.x() + rect.width() * 0.80, rect.y() + rect.height() * 0.80);
+
+    }else{
+
+        //Draw from top left, to middle bottom, to top right
+        trianglePolygon << QPoint(rect.x() + rect.width() * 0.20, rect.y() + rect.height() * 0.20);
+        trianglePolygon << QPoint(rect.x() + rect.width() / 2.0,  rect.y() + rect.height() * 0.80);
+        trianglePolygon << QPoint(rect.x() + rect.width() * 0.80, rect.y() + rect.height() * 0.20);
+
+    }
+
+    return trianglePolygon;
+
+}
+
+/*
+ * Helper function used by the constructor to initialize the context menu policy.
+ */
+void RangeLineEditBase::createCustomContextMenu(){
+
+    //Production::Note: The menu itself is shared by every RangeLineEdit, and only built the first time one of them is right clicked
+    setContextMenuPolicy(Qt::CustomContextMenu);
+
+}
+
+/*
+ * Returns the context menu shared by every RangeLineEdit in the process, building it on first use
+ */
+RangeLineEditBase::SharedContextMenu& RangeLineEditBase::sharedContextMenu(){
+
+    static SharedContextMenu sharedMenu = {nullptr, nullptr, nullptr, nullptr, nullptr};
+
+    if(sharedMenu.m_menu.isNull()){
+
+        sharedMenu.m_menu = new QMenu();
+
+        sharedMenu.m_copyAsTextToClipBoardAction     = sharedMenu.m_menu->addAction("Copy  [As text]");
+        sharedMenu.m_copyAsValueToClipBoardAction    = sharedMenu.m_menu->addAction("Copy  [As value]");
+        sharedMenu.m_pasteAsValueFromClipBoardAction = sharedMenu.m_menu->addAction("Paste [From value]");
+        sharedMenu.m_clearAction                     = sharedMenu.m_menu->addAction("Clear");
+
+        //The menu has no parent to delete it, so it goes away with the application instead
+        if(QCoreApplication::instance() != nullptr){
+
+            QMenu* menu = sharedMenu.m_menu;
+            QObject::connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, menu, [menu](){ delete menu; }, Qt::DirectConnection);
+
+        }
+
+    }
+
+    return sharedMenu;
+
+}
+
+/*
+ * Helper function for returning the given Range for the index in this widget's QLineEdit::text()
+ * A lookup in the cursor map, falling back to the last Range for any index outside of it
+ */
+::Range* RangeLineEditBase::getRangeForIndex(int index){
+
+    ::Range* rangeForIndex(nullptr);
+    if(index >= 0 && index < m_cursorMap.size()){
+
+        rangeForIndex = m_cursorMap.at(index).m_range;
+
+    }
+    //This can occur if the cursor position is all of the way at the end
+    else if(m_ranges.isEmpty() == false){
+
+        rangeForIndex = m_ranges.last();
+
+    }
+
+    return rangeForIndex;
+
+}
+
+/*
+ * Helper function that rebuilds the cursor map from the Ranges' current start and end indices.
+ * Each position records its Range, its significant figure's index and step weight, whether it's editable,
+ * and where seekLeft() and seekRight() move to from it, so cursor navigation and step resolution are array lookups.
+ * Production::Note: Seeking never hops left onto the head Range, it can only be reached by moving onto it one position at a time
+ */
+void RangeLineEditBase::syncCursorMap(){
+
+    m_cursorMap.clear();
+
+    if(m_ranges.isEmpty()){
+
+        return;
+
+    }
+
+    const int textLength = m_ranges.last()->m_charIndexEnd + 1;
+    m_cursorMap.resize(textLength + 1);
+
+    //Left to right, remembering the end of the closest editable Range (other than the head) to hop back onto.
+    //The position past the last character belongs to the last Range, but there's no digit there to step
+    int previousEditableEnd(-1);
+    for(int i = 0; i < m_ranges.size(); ++i){
+
+        ::Range*   range         = m_ranges.at(i);
+        const bool editable      = (range->m_kind != ::Range::RANGE_STRING_CONSTANT);
+        const int  lastCharIndex = (i == m_ranges.size() - 1) ? textLength : range->m_charIndexEnd;
+
+        for(int charIndex = range->m_charIndexStart; charIndex <= lastCharIndex; ++charIndex){
+
+            CursorMapEntry& entry = m_cursorMap[charIndex];
+
+            entry.m_range      = range;
+            entry.m_localIndex = range->m_charIndexEnd - charIndex;
+            entry.m_editable   = editable && charIndex <= range->m_charIndexEnd;
+
+            const bool leavesRange    = (charIndex == range->m_charIndexStart) || editable == false;
+            entry.m_previousEditable = (leavesRange && previousEditableEnd >= 0) ? previousEditableEnd : charIndex - 1;
+
+        }
+
+        if(editable && i > 0){
+
+            previousEditableEnd = range->m_charIndexEnd;
+
+        }
+
+    }
+
+    //Right to left, remembering the start of the closest editable Range to hop forward onto
+    int nextEditableStart(-1);
+    for(int i = m_ranges.size() - 1; i >= 0; --i){
+
+        ::Range*   range    = m_ranges.at(i);
+        const bool editable = (range->m_kind != ::Range::RANGE_STRING_CONSTANT);
+
+        for(int charIndex = range->m_charIndexStart; charIndex <= range->m_charIndexEnd; ++charIndex){
+
+            const bool leavesRange = (charIndex == range->m_charIndexEnd) || editable == false;
+            m_cursorMap[charIndex].m_nextEditable = (leavesRange && nextEditableStart >= 0) ? nextEditableStart : charIndex + 1;
+
+        }
+
+        if(editable){
+
+            nextEditableStart = range->m_charIndexStart;
+
+        }
+
+    }
+
+    m_cursorMap[textLength].m_nextEditable = textLength;
+
+}
+
+/*
+ * Helper function for writing the proper string representation of a given Range into its slot of the composed text
+ */
+void RangeLineEditBase::scrapeTextFromRangeValue(::Range* range, const QString& currentText, QChar* destination, bool overrideBeingDirty){
+
+    const int width = range->m_charIndexEnd - range->m_charIndexStart + 1;
+
+    //Production::Note: A clean Range keeps its indices, but the current text may be shorter than the layout (i.e. emptied by QLineEdit::clear())
+    if(range->m_dirty || overrideBeingDirty || range->m_charIndexEnd >= currentText.length()){
+
+        const QString paddedText = range->valueStr();
+        std::copy_n(paddedText.constData(), std::min(width, paddedText.length()), destination + range->m_charIndexStart);
+
+        range->m_dirty = false;
+
+    }else{
+
+        std::copy_n(currentText.constData() + range->m_charIndexStart, width, destination + range->m_charIndexStart);
+
+    }
+
+}
+
+/*
+ * Helper function for tying the Ranges together properly during initialization and any subsequent calls to setPrecision(...).
+ * This will sync all Range's left and right neighbors properly and initialize their start and end indices as well.
+ */
+void RangeLineEditBase::syncRangeEdges(){
+
+    syncRangeLists();
+
+    int curRangeOffset(0);
+
+    for(int i = 0; i < m_ranges.size() - 1; ++i){
+
+        ::Range* leftRange  = m_ranges[i];
+        ::Range* rightRange = m_ranges[i + 1];
+
+        leftRange->m_rightRange = rightRange;
+        rightRange->m_leftRange = leftRange;
+
+        leftRange->m_charIndexStart = curRangeOffset;
+        curRangeOffset += leftRange->rangeLength();
+        leftRange->m_charIndexEnd = curRangeOffset - 1;
+
+        leftRange->m_dirty  = true;
+        rightRange->m_dirty = true;
+
+    }
+
+    //Now clean up the last indice's ranges and left range value
+    if(m_ranges.size() >= 2){
+
+        m_ranges.last()->m_leftRange = m_ranges.at(m_ranges.size() - 2);
+        m_ranges.last()->m_charIndexStart = curRangeOffset;
+
+        curRangeOffset += m_ranges.last()->rangeLength();
+
+        m_ranges.last()->m_charIndexEnd = curRangeOffset - 1;
+        m_ranges.last()->m_dirty = true;
+
+    }
+
+    //The ends may still point at Ranges that were popped off (or prepended) since the last sync
+    if(m_ranges.isEmpty() == false){
+
+        m_ranges.first()->m_leftRange = nullptr;
+        m_ranges.last()->m_rightRange = nullptr;
+
+    }
+
+    syncCursorMap();
+
+    scrapeDirtiedRanges(true);
+
+}
+
+/*
+ * Helper function that rebuilds the per-layout lists (all RangeInts and the head RangeChar)
+ * from m_ranges, so hot paths can iterate them directly instead of testing every Range's type.
+ * Also fills in every Range's layout caches (head, left-most RangeInt and RangeChar, neighboring RangeInts and the non-zero mask),
+ * so none of the Range queries have to walk the list.
+ * Must be called whenever m_ranges is modified, which syncRangeEdges() does for you.
+ * Empties the cursor map, since it may point at removed Ranges until syncRangeEdges() rebuilds it.
+ */
+void RangeLineEditBase::syncRangeLists(){
+
+    m_rangeInts.clear();
+    m_cursorMap.clear();
+    m_rangeChar        = nullptr;
+    m_nonZeroRangeInts  = 0ULL;
+    m_negativeRangeInts = 0ULL;
+    ++m_valueRevision;
+
+    ::Range*   head              = m_ranges.isEmpty() ? nullptr : m_ranges.first();
+    RangeInt*  leftMostRangeInt  = nullptr;
+    RangeChar* leftMostRangeChar = nullptr;
+
+    for(int i = 0; i < m_ranges.size(); ++i){
+
+        ::Range* range = m_ranges.at(i);
+
+        //Everything here only looks at Ranges to the left, so it's settled before this Range is appended below
+        range->m_headRange         = head;
+        range->m_leftMostRangeChar = leftMostRangeChar;
+        range->m_previousRangeInt  = m_rangeInts.isEmpty() ? nullptr : m_rangeInts.last();
+        range->m_rangeIntsToLeft   = m_rangeInts.size();
+        range->m_nonZeroRangeInts  = &m_nonZeroRangeInts;
+        range->m_negativeRangeInts = &m_negativeRangeInts;
+        range->m_valueRevision     = &m_valueRevision;
+
+        if(range->m_kind == ::Range::RANGE_INT){
+
+            RangeInt* rangeInt = static_cast<RangeInt*>(range);
+
+            if(leftMostRangeInt == nullptr){
+
+                leftMostRangeInt = rangeInt;
+
+            }
+
+            m_rangeInts << rangeInt;
+            rangeInt->syncLayoutState();
+
+        }else if(range->m_kind == ::Range::RANGE_CHAR){
+
+            if(leftMostRangeChar == nullptr){
+
+                leftMostRangeChar = static_cast<RangeChar*>(range);
+
+            }
+
+            if(i == 0){
+
+                m_rangeChar = static_cast<RangeChar*>(range);
+
+            }
+
+        }
+
+        range->m_leftMostRangeInt = leftMostRangeInt;
+
+    }
+
+    //Walk back from the tail to hand every Range its next RangeInt
+    RangeInt* nextRangeInt = nullptr;
+    for(int i = m_ranges.size() - 1; i >= 0; --i){
+
+        m_ranges.at(i)->m_nextRangeInt = nextRangeInt;
+
+        if(m_ranges.at(i)->m_kind == ::Range::RANGE_INT){
+
+            nextRangeInt = static_cast<RangeInt*>(m_ranges.at(i));
+
+        }
+
+    }
+
+}
+
+/*
+ * Helper function that composes the whole text in one pass, delegating a call to scrapeTextFromRangeValue(...) on each held Range,
+ * then hands it to QLineEdit::setText(...) at most once, and not at all if nothing changed.
+ * When the length is unchanged (every edit that isn't a layout change) the cursor is kept where it was, without any cursorPositionChanged.
+ * Deferred until the end of the outermost BatchUpdate, if there is one.
+ */
+void RangeLineEditBase::scrapeDirtiedRanges(bool overrideBeingDirty){
+
+    //Inside a BatchUpdate, only remember that (and how) the text needs scraping
+    if(m_batchDepth > 0){
+
+        m_batchPendingScrape      = true;
+        m_batchPendingFullScrape |= overrideBeingDirty;
+        return;
+
+    }
+
+    const QString originalText = text();
+    const int     textLength   = m_ranges.isEmpty() ? 0 : m_ranges.last()->m_charIndexEnd + 1;
+
+    //Production::Note: m_textBuffer keeps its capacity between calls, so composing only allocates if QLineEdit still shares the previous text
+    m_textBuffer.resize(textLength);
+    QChar* destination = m_textBuffer.data();
+
+    foreach(::Range* range, m_ranges){
+
+        scrapeTextFromRangeValue(range, originalText, destination, overrideBeingDirty);
+
+    }
+
+    if(m_textBuffer != originalText){
+
+        //Restores the previous state, rather than unblocking, so a caller batching several scrapes keeps textChanged held back
+        const bool signalsWereBlocked = blockSignals(true);
+        const int  focusIndex         = cursorPosition();
+
+        setText(m_textBuffer);
+
+        //Production::Note: QLineEdit::setText(...) moves the cursor to the end. Ranges are fixed-width, so a same-length update
+        //only swaps characters and the cursor goes straight back, while signals are still blocked, so cursorPositionChangedEvent(...)
+        //isn't run for a position that never really changed
+        if(m_textBuffer.length() == originalText.length()){
+
+            setCursorPosition(focusIndex);
+
+        }
+
+        blockSignals(signalsWereBlocked);
+
+        //Doing this will ensure one emission of QLineEdit::textChanged(...) will occur for a given batch update
+        emit textChanged(text());
+
+    }
+
+}
+
+/*
+ * Clears all Ranges properly, nulls out the memory, and clears the held list
+ */
+void RangeLineEditBase::clearCurrentValidators(){
+
+    foreach(::Range* range, m_ranges){
+
+        m_rangePool.destroy(range);
+
+    }
+
+    m_ranges.clear();
+    syncRangeLists();
+
+}
+
+/*
+ * Attempts to increment the Range at the current cursor index
+ */
+void RangeLineEditBase::increment(){
+
+    stepActiveIndexBy(1LL);
+
+}
+
+/*
+ * Attempts to decrement the Range at the current cursor index
+ */
+void RangeLineEditBase::decrement(){
+
+    stepActiveIndexBy(-1LL);
+
+}
+
+/*
+ * Attempts to step the Range at the current cursor index by steps units of the digit there, as one update
+ */
+void RangeLineEditBase::stepActiveIndexBy(long long steps){
+
+    stepBy(steps, m_prevCursorPosition);
+
+}
+
+/*
+ * Helper function for wheelEvent(...) that adds delta to remainder, then takes as many whole steps out of it as it holds
+ */
+long long RangeLineEditBase::accumulateWheelDelta(int delta, int deltaPerStep, int& remainder){
+
+    if((remainder > 0 && delta < 0) || (remainder < 0 && delta > 0)){
+
+        remainder     = 0;
+        m_wheelStreak = 0;
+
+    }
+
+    remainder += delta;
+
+    //Integer division truncates toward zero, so the remainder keeps the direction it was accumulated in
+    const int steps = remainder / deltaPerStep;
+    remainder -= steps * deltaPerStep;
+
+    return steps;
+
+}
+
+/*
+ * Applies the whole wheel steps accumulated since the last frame as a single stepActiveIndexBy(...)
+ */
+void RangeLineEditBase::applyPendingWheelSteps(){
+
+    const long long steps = m_pendingWheelSteps;
+    m_pendingWheelSteps = 0LL;
+
+    stepActiveIndexBy(steps);
+
+}
+
+/*
+ * Steps once in the held step button's direction, by a digit weight that grows the longer the button has been held
+ */
+void RangeLineEditBase::autoRepeatStep(){
+
+    //Production::Note: Like a QAbstractButton, the repeat pauses while the pointer is dragged off the held button
+    if(m_pressedStepButton != NO_STEP_BUTTON && m_pressedStepButton == m_hoveredStepButton){
+
+        //Still in the initial delay, or within the first decade of repeating, this is a single unit of the digit
+        const qint64 repeatingFor = m_autoRepeatClock.isValid() ? m_autoRepeatClock.elapsed() : 0;
+        const int    decades      = static_cast<int>(std::min<qint64>(repeatingFor / AUTO_REPEAT_DECADE_MS, AUTO_REPEAT_MAXIMUM_DECADES));
+
+        long long steps(1LL);
+        for(int decade = 0; decade < decades; ++decade){
+
+            steps *= 10LL;
+
+        }
+
+        stepActiveIndexBy((m_pressedStepButton == INCREMENT_STEP_BUTTON) ? steps : -steps);
+
+    }
+
+}
+
+/*
+ * Attempts to move the cursor position to the left to the next valid, editable, Range subtype
+ */
+void RangeLineEditBase::seekLeft(){
+
+    int focusIndex = this->cursorPosition();
+
+    //No point to move left if we're at 0
+    if(focusIndex > 0 && focusIndex < m_cursorMap.size()){
+
+        setCursorPosition(m_cursorMap.at(focusIndex).m_previousEditable);
+
+    }
+
+}
+
+/*
+ * Attempts to move the cursor position to the right to the next valid, editable, Range subtype
+ */
+void RangeLineEditBase::seekRight(){
+
+    int focusIndex = this->cursorPosition();
+
+    //No point to move right if we're at the end
+    if(focusIndex < this->text().length() && focusIndex < m_cursorMap.size()){
+
+        setCursorPosition(m_cursorMap.at(focusIndex).m_nextEditable);
+
+    }
+
+}
+
+/*
+ * Helper function that ensures any changes to the value of a Range will not exceed the maximum allowable set value.
+ * If the maximum is exceeded, the first-most RangeInt will be set to its range and all subsequent RangeInts will be zeroed out.
+ * Deferred until the end of the outermost BatchUpdate, if there is one.
+ */
+void RangeLineEditBase::maximumExceededFixup(){
+
+    if(m_batchDepth > 0 && m_batchFlushing == false){
+
+        m_batchPendingFixups = true;
+        return;
+
+    }
+
+    //Assume false and prove otherwise
+    bool atOrExceedsValue(false);
+
+    //This will essentially zero out all RangeInts and set the first one to the max allowed value
+    if(valueExceedsMaximum()){
+
+        atOrExceedsValue = true;
+        foreach(RangeInt* rangeInt, m_rangeInts){
+
+            rangeInt->setValue(0LL);
+            rangeInt->m_dirty = true;
+
+        }
+
+    }
+
+    if(Q_UNLIKELY(atOrExceedsValue)){
+
+        //The first RangeInt gets set to the maximum range
+        if(m_rangeInts.isEmpty() == false){
+
+            m_rangeInts.first()->setValue(m_maxAllowableValue);
+
+        }
+
+        maximumWasExceeded();
+
+        //Production::Note: The text keeps its length, so scrapeDirtiedRanges() keeps the cursor where it was
+        syncRangeSigns();
+        scrapeDirtiedRanges();
+
+    }
+
+}
+
+/*
+ * Invoked by maximumExceededFixup() after it clamped the Ranges to the maximum allowable value.
+ * Subclasses holding on to precision that isn't displayed should drop it here.
+ */
+void RangeLineEditBase::maximumWasExceeded(){
+
+    /* NOP */
+
+}
+
+/*
+ * The part of the value that isn't displayed, compared by a BatchUpdate whose text didn't change to tell whether valueChanged is still owed.
+ * Subclasses holding on to precision that isn't displayed should return it here.
+ */
+long double RangeLineEditBase::undisplayedPrecision() const{
+
+    return 0.0L;
+
+}
+
+/*
+ * Ensures if the signage (+/-) changes as a result of the RangeChar being modified,
+ * that all subsequent RangeInt types match the same sign (+/-) for their underlying value.
+ * Only the RangeInts whose sign actually disagrees are flipped (and dirtied), found through the layout's sign masks.
+ * Deferred until the end of the outermost BatchUpdate, if there is one.
+ */
+void RangeLineEditBase::syncRangeSigns(){
+
+    if(m_batchDepth > 0 && m_batchFlushing == false){
+
+        m_batchPendingFixups = true;
+        return;
+
+    }
+
+    //The layout's sign bit, assumed positive without a head RangeChar
+    const bool negative = (m_rangeChar != nullptr && m_rangeChar->m_value != m_rangeChar->m_positiveChar);
+
+    //Zeroes never disagree, so only the non-zero RangeInts on the wrong side of 0 need flipping:
+    //the positive ones while negative, and the negative ones while positive
+    quint64 mismatched = negative ? (m_nonZeroRangeInts & ~m_negativeRangeInts) : m_negativeRangeInts;
+    bool    flipped    = (mismatched != 0ULL);
+
+    for(int i = 0; mismatched != 0ULL; ++i, mismatched >>= 1){
+
+        if(mismatched & 1ULL){
+
+            RangeInt* rangeInt = m_rangeInts.at(i);
+            rangeInt->setValue(-rangeInt->m_value);
+
+        }
+
+    }
+
+    //Production::Note: Only the first 64 RangeInts have a bit in the masks, so any past them are checked one by one
+    for(int i = 64; i < m_rangeInts.size(); ++i){
+
+        RangeInt* rangeInt = m_rangeInts.at(i);
+
+        if(rangeInt->m_value != 0LL && (rangeInt->m_value < 0LL) != negative){
+
+            rangeInt->setValue(-rangeInt->m_value);
+            flipped = true;
+
+        }
+
+    }
+
+    //Only the flipped RangeInts were dirtied, and a sign that didn't change leaves nothing to render
+    if(flipped){
+
+        scrapeDirtiedRanges();
+
+    }
+
+}
+
+/*
+ * Returns a sum of all RangeInts' values / RangeInts' divisors, without the undisplayed precision
+ * The sum is accumulated exactly, as an integer count of the layout's smallest unit (see unitDivisor()), and converted with a single division,
+ * so the result is the same on every platform and compiler. A layout whose divisors don't nest falls back to adding each term in floating point.
+ * Cached until a RangeInt's value or divisor changes (or the layout does), so repeated reads are free.
+ */
+long double RangeLineEditBase::sumRangeInts(){
+
+    if(m_sumRangeIntsRevision == m_valueRevision){
+
+        return m_sumRangeIntsCache;
+
+    }
+
+    long double     sum(0.0L);
+    const long long units = unitDivisor();
+
+    if(units > 0LL){
+
+        WideInt numerator(0);
+        foreach(RangeInt* rangeInt, m_rangeInts){
+
+            const WideInt weight    = units / rangeInt->m_divisor;
+            const WideInt magnitude = saturatingMultiply(rangeInt->m_value < 0LL ? -WideInt(rangeInt->m_value) : WideInt(rangeInt->m_value), weight);
+
+            numerator = saturatingAdd(numerator, rangeInt->m_value < 0LL ? -magnitude : magnitude);
+
+        }
+
+        sum = static_cast<long double>(numerator) / static_cast<long double>(units);
+
+    }else{
+
+        foreach(RangeInt* rangeInt, m_rangeInts){
+
+            sum += static_cast<long double>(rangeInt->m_value) / static_cast<long double>(rangeInt->m_divisor);
+
+        }
+
+    }
+
+    m_sumRangeIntsCache    = sum;
+    m_sumRangeIntsRevision = m_valueRevision;
+
+    return sum;
+
+}
+
+/*
+ * Returns the divisor of the layout's smallest unit: the largest RangeInt divisor, provided every other RangeInt divisor divides it.
+ * (i.e. 3600 * 10^decimals for D°M'S''.s, 10^decimals for a double, 1 for a phone number)
+ * Every RangeInt is then worth a whole number of units. Returns 0 for a layout whose divisors don't nest.
+ */
+long long RangeLineEditBase::unitDivisor(){
+
+    long long units(1LL);
+    foreach(RangeInt* rangeInt, m_rangeInts){
+
+        units = std::max(units, rangeInt->m_divisor);
+
+    }
+
+    foreach(RangeInt* rangeInt, m_rangeInts){
+
+        if(units % rangeInt->m_divisor != 0LL){
+
+            return 0LL;
+
+        }
+
+    }
+
+    return units;
+
+}
+
+/*
+ * Splits a non-negative magnitude across the RangeInts as an exact count of the layout's smallest unit, clamped to the maximum allowable value.
+ * The RangeInts are left positive, so call syncRangeSigns() afterwards.
+ * Returns the magnitude now displayed, so the caller can keep whatever didn't fit as undisplayed precision.
+ */
+long double RangeLineEditBase::setRangeIntMagnitudes(long double magnitude){
+
+    const long long units = unitDivisor();
+
+    if(units > 0LL){
+
+        //Production::Note: A remainder of more than a tenth of a unit is taken as the input having landed just shy of the next unit
+        //through floating point error (i.e. 47.55 * 3600 = 171179.99999999997), and rounds up. Anything smaller is left undisplayed
+        const long double scaled   = magnitude * static_cast<long double>(units);
+        const WideInt     maxUnits = saturatingMultiply(m_maxAllowableValue, units);
+
+        WideInt remaining(0);
+        if(scaled >= static_cast<long double>(maxUnits)){
+
+            remaining = maxUnits;
+
+        }else if(scaled > 0.1L){
+
+            remaining = std::min(static_cast<WideInt>(std::ceil(scaled - 0.1L)), maxUnits);
+
+        }
+
+        //Most significant first, each RangeInt takes as many of its own units as fit and leaves the rest to its right
+        foreach(RangeInt* rangeInt, m_rangeInts){
+
+            const WideInt weight = units / rangeInt->m_divisor;
+            const WideInt value  = remaining / weight;
+
+            rangeInt->setValue(static_cast<long long>(std::min(value, WideInt(LLONG_MAX))));
+            remaining -= value * weight;
+
+        }
+
+    }else{
+
+        //Without a common unit, each RangeInt takes the whole part of what's left in its own units
+        foreach(RangeInt* rangeInt, m_rangeInts){
+
+            const long double value = std::floor(magnitude * static_cast<long double>(rangeInt->m_divisor));
+
+            rangeInt->setValue(static_cast<long long>(value));
+            magnitude -= static_cast<long double>(rangeInt->m_value) / static_cast<long double>(rangeInt->m_divisor);
+
+        }
+
+    }
+
+    return sumRangeInts();
+
+}
+
+/*
+ * Overridden QKeyEvent
+ * Manages calls to all of the helper functions to change the state of this widget
+ */
+void RangeLineEditBase::keyPressEvent(QKeyEvent* keyEvent){
+
+    int key(keyEvent->key());
+
+    //Production::Note: The order of these if statements have specific precedence.
+    //The last check: `keyEvent->text().length() == 1` will trigger on any single key length,
+    //so if adding new functionality, ensure that it remains as the last if check to ensure new
+    //functionality isn't being skipped over.
+
+    if(key == Qt::Key_Up){
+
+        increment();
+
+    }else if(key == Qt::Key_Down){
+
+        decrement();
+
+    }else if(key == Qt::Key_Left){
+
+        seekLeft();
+
+    }else if(key == Qt::Key_Right){
+
+        seekRight();
+
+    }else if(key == Qt::Key_Backspace){
+
+        setValueForIndex('0', this->cursorPosition());
+
+        seekLeft();
+
+    }else if(key == Qt::Key_Delete){
+
+        setValueForIndex('0', this->cursorPosition());
+
+        seekRight();
+
+    }else if(keyEvent->matches(QKeySequence::Copy)){
+
+        copyValueToClipboard();
+
+    }else if(keyEvent->matches(QKeySequence::Paste)){
+
+        pasteValueFromClipboard();
+
+    }else if(key == Qt::Key_Home || key == Qt::Key_End){
+
+        QLineEdit::keyPressEvent(keyEvent);
+
+    }
+    //Production::Note: Add new `else if`s above this one
+    else if(keyEvent->text().length() == 1){
+
+        if(setValueForIndex(keyEvent->text().at(0), this->cursorPosition())){
+
+            seekRight();
+
+        }
+
+    }//Production::Note: Don't even think about adding another `else if` below here
+
+}
+
+/*
+ * Overridden QPaintEvent
+ * Calls base class behavior before attemtping to paint a small colored rectangle around
+ * the current cursor's position to denote which index is currently in an editable context
+ */
+void RangeLineEditBase::paintEvent(QPaintEvent* paintEvent){
+
+    //Draw the QLineEdit as normal
+    QLineEdit::paintEvent(paintEvent);
+
+    QPainter painter(this);
+
+    //Below highlights the current text that has focus in the widget and will be affected by an increment, decrement, or key press operation
+    m_highlightRect = highlightVisible() ? highlightRect() : QRect();
+    if(m_highlightRect.isNull() == false){
+
+        painter.setPen(QPen(QColor(255, 255, 255, 0)));
+        painter.setBrush(QBrush(m_highlightColor));
+        painter.drawRect(m_highlightRect);
+
+    }
+
+    if(m_stepButtonsVisible){
+
+        paintStepButtons(painter);
+
+    }
+
+}
+
+/*
+ * Overridden QResizeEvent
+ * Modifies the size and position of the increment and decrement push buttons
+ * to always be with respect to this widget's width.
+ */
+void RangeLineEditBase::resizeEvent(QResizeEvent* resizeEvent){
+
+    //This will make it so the buttons have some wiggle room (simulates as if they're in a layout, without actually being in one)
+    //These buttons have an enforced minimum and maximum width, so they will scale slightly with the size of the widget, to an extent
+    const int buttonWidth  = std::max(STEP_BUTTON_MINIMUM_WIDTH, std::min(static_cast<int>(width() * 0.10), STEP_BUTTON_MAXIMUM_WIDTH));
+    const int buttonHeight = height() / 2 - 1;
+
+    m_incrementButtonRect = QRect(width() - buttonWidth, 1,            buttonWidth, buttonHeight);
+    m_decrementButtonRect = QRect(width() - buttonWidth, height() / 2, buttonWidth, buttonHeight);
+
+    QLineEdit::resizeEvent(resizeEvent);
+
+}
+
+/*
+ * Overridden QWheelEvent
+ * Accumulates the wheel's angle (or a touchpad's pixel) delta into whole steps up or down for the given active index.
+ * Steps arriving in quick succession are accelerated, and they're applied at most once per frame, so each event only costs some arithmetic.
+ */
+void RangeLineEditBase::wheelEvent(QWheelEvent* wheelEvent){
+
+    if(this->hasFocus()){
+
+        if(wheelEvent->phase() == Qt::ScrollBegin){
+
+            m_wheelAngleRemainder = 0;
+            m_wheelPixelRemainder = 0;
+
+        }
+
+        //A high resolution touchpad reports pixels, a mouse wheel only reports eighths of a degree
+        long long steps(0LL);
+        if(wheelEvent->pixelDelta().y() != 0){
+
+            steps = accumulateWheelDelta(wheelEvent->pixelDelta().y(), WHEEL_PIXELS_PER_STEP, m_wheelPixelRemainder);
+
+        }else if(wheelEvent->angleDelta().y() != 0){
+
+            steps = accumulateWheelDelta(wheelEvent->angleDelta().y(), WHEEL_ANGLE_PER_STEP, m_wheelAngleRemainder);
+
+        }
+
+        if(steps != 0LL){
+
+            //Whole steps arriving in quick succession are a flick, which ramps up how far each of them goes
+            if(m_wheelClock.isValid() && m_wheelClock.elapsed() < WHEEL_ACCELERATION_WINDOW_MS){
+
+                ++m_wheelStreak;
+
+            }else{
+
+                m_wheelStreak = 0;
+
+            }
+
+            m_wheelClock.start();
+
+            steps *= std::min(1 + m_wheelStreak / WHEEL_ACCELERATION_RAMP, WHEEL_MAXIMUM_ACCELERATION);
+            m_pendingWheelSteps += steps;
+
+            //Production::Note: The first steps are applied right away, anything arriving during the following frame is applied with it as one update
+            if(m_wheelFrameTimer.isActive() == false){
+
+                applyPendingWheelSteps();
+                m_wheelFrameTimer.start(WHEEL_FRAME_INTERVAL_MS, this);
+
+            }
+
+        }
+
+    }
+
+    wheelEvent->accept();
+
+}
+
+/*
+ * Overridden QMouseEvent
+ * A press on a step button steps once and holds it down, auto-repeating like a QSpinBox's arrows. Anything else is handled by QLineEdit as usual
+ */
+void RangeLineEditBase::mousePressEvent(QMouseEvent* mouseEvent){
+
+    StepButton stepButton = (mouseEvent->button() == Qt::LeftButton) ? stepButtonAt(mouseEvent->pos()) : NO_STEP_BUTTON;
+    if(stepButton != NO_STEP_BUTTON){
+
+        //Production::Note: QLineEdit never sees the press, so the cursor stays on the index about to be stepped
+        m_pressedStepButton = stepButton;
+        setHoveredStepButton(stepButton);
+        update(stepButtonRect(stepButton));
+
+        //The press steps right away, the repeat only starts if the button is still held once the delay is over
+        m_autoRepeatClock.invalidate();
+        autoRepeatStep();
+        m_autoRepeatTimer.start(AUTO_REPEAT_DELAY_MS, this);
+
+        mouseEvent->accept();
+
+    }else{
+
+        QLineEdit::mousePressEvent(mouseEvent);
+
+    }
+
+}
+
+/*
+ * Overridden QMouseEvent
+ * Treated as a second press, so a fast double click on a step button steps twice like it would on a QSpinBox
+ */
+void RangeLineEditBase::mouseDoubleClickEvent(QMouseEvent* mouseEvent){
+
+    if(mouseEvent->button() == Qt::LeftButton && stepButtonAt(mouseEvent->pos()) != NO_STEP_BUTTON){
+
+        mousePressEvent(mouseEvent);
+
+    }else{
+
+        QLineEdit::mouseDoubleClickEvent(mouseEvent);
+
+    }
+
+}
+
+/*
+ * Overridden QMouseEvent
+ * Releasing a held step button stops its auto-repeat
+ */
+void RangeLineEditBase::mouseReleaseEvent(QMouseEvent* mouseEvent){
+
+    if(m_pressedStepButton != NO_STEP_BUTTON && mouseEvent->button() == Qt::LeftButton){
+
+        update(stepButtonRect(m_pressedStepButton));
+        m_pressedStepButton = NO_STEP_BUTTON;
+        m_autoRepeatTimer.stop();
+
+        mouseEvent->accept();
+
+    }else{
+
+        QLineEdit::mouseReleaseEvent(mouseEvent);
+
+    }
+
+}
+
+/*
+ * Overridden QMouseEvent
+ * Tracks which step button is hovered (This widget has mouse tracking on while the step buttons are visible)
+ */
+void RangeLineEditBase::mouseMoveEvent(QMouseEvent* mouseEvent){
+
+    //Production::Note: This only repaints when the pointer crosses a step button's edge
+    setHoveredStepButton(stepButtonAt(mouseEvent->pos()));
+
+    //Without a button held this is only mouse tracking, which QLineEdit has nothing to do with.
+    //While a step button is held, dragging mustn't start a text selection
+    if(mouseEvent->buttons() != Qt::NoButton && m_pressedStepButton == NO_STEP_BUTTON){
+
+        QLineEdit::mouseMoveEvent(mouseEvent);
+
+    }
+
+}
+
+/*
+ * Overridden QEvent::leaveEvent
+ * Nothing is hovered once the mouse has left
+ */
+void RangeLineEditBase::leaveEvent(QEvent* leaveEvent){
+
+    setHoveredStepButton(NO_STEP_BUTTON);
+    QLineEdit::leaveEvent(leaveEvent);
+
+}
+
+/*
+ * Overridden QEvent::changeEvent
+ * Measured character advances are dropped once the font or style changes
+ */
+void RangeLineEditBase::changeEvent(QEvent* changeEvent){
+
+    if(changeEvent->type() == QEvent::FontChange || changeEvent->type() == QEvent::StyleChange){
+
+        m_charAdvances.clear();
+        m_charOffsetsDirty = true;
+
+    }
+
+    QLineEdit::changeEvent(changeEvent);
+
+}
+
+/*
+ * Overridden QTimerEvent
+ * Applies the wheel steps accumulated during the last frame, and stops once a frame goes by without any.
+ * Also drives the auto-repeat of a held step button
+ */
+void RangeLineEditBase::timerEvent(QTimerEvent* timerEvent){
+
+    if(timerEvent->timerId() == m_wheelFrameTimer.timerId()){
+
+        if(m_pendingWheelSteps != 0LL){
+
+            applyPendingWheelSteps();
+
+        }else{
+
+            m_wheelFrameTimer.stop();
+
+        }
+
+    }else if(timerEvent->timerId() == m_autoRepeatTimer.timerId()){
+
+        //Production::Note: Once the delay is over this ticks once per frame, so each tick is one step and at most one repaint.
+        //Timer events are never queued up behind each other, a slow step only delays the next tick rather than piling them up
+        if(m_autoRepeatClock.isValid() == false){
+
+            m_autoRepeatClock.start();
+            m_autoRepeatTimer.start(AUTO_REPEAT_INTERVAL_MS, this);
+
+        }
+
+        autoRepeatStep();
+
+    }else{
+
+        QLineEdit::timerEvent(timerEvent);
+
+    }
+
+}
+
+/* --- Protected Slots ---*/
+
+/*
+ * Connected to RangeLineEdit::customContextMenuRequested.
+ * Invoked on a right click event and spawns a custom context menu.
+ */
+void RangeLineEditBase::showContextMenu(const QPoint& pos){
+
+    SharedContextMenu& sharedMenu = sharedContextMenu();
+
+    //Production::Note: The menu is shared, so rather than being connected to any one widget, whichever action was picked is carried out on this one
+    QPointer<RangeLineEditBase> target(this);
+    QAction* chosenAction = sharedMenu.m_menu->exec(mapToGlobal(pos));
+
+    //The paste operation is only ever disabled for the widget the menu was just shown for
+    if(sharedMenu.m_menu.isNull() == false){
+
+        sharedMenu.m_pasteAsValueFromClipBoardAction->setEnabled(true);
+
+    }
+
+    if(chosenAction == nullptr || target.isNull()){
+
+        return;
+
+    }
+
+    if(chosenAction == sharedMenu.m_copyAsTextToClipBoardAction){
+
+        copyTextToClipboard();
+
+    }else if(chosenAction == sharedMenu.m_copyAsValueToClipBoardAction){
+
+        copyValueToClipboard();
+
+    }else if(chosenAction == sharedMenu.m_pasteAsValueFromClipBoardAction){
+
+        pasteValueFromClipboard();
+
+    }else if(chosenAction == sharedMenu.m_clearAction){
+
+        clearText();
+
+    }
+
+}
+
+/*
+ * Connected to RangeLineEdit::cursorPositionChanged.
+ * Invoked whenever the cursor position was changed.
+ * Ensures the cursor is only ever on top of an editable Range.
+ */
+void RangeLineEditBase::cursorPositionChangedEvent(int, int cur){
+
+    ::Range* range = getRangeForIndex(cur);
+    if(range != nullptr && range->m_kind == ::Range::RANGE_STRING_CONSTANT){
+
+        //Go to the left, if possible, otherwise fall back to the right
+        if(range->m_leftRange != nullptr){
+
+            setCursorPosition(range->m_leftRange->m_charIndexEnd);
+
+        }else if(range->m_rightRange != nullptr){
+
+            setCursorPosition(range->m_rightRange->m_charIndexStart);
+
+        }
+
+    }
+    //In the case we don't have a RangeStringConstant at the end
+    else if(cur == text().length()){
+
+        setCursorPosition(cur - 1);
+
+    }
+
+    if(this->hasFocus()){
+
+        m_prevCursorPosition = cursorPosition();
+
+    }
+
+    //Production::Note: QLineEdit only repaints around the caret, which doesn't cover all of the highlighted character
+    updateHighlight();
+
+}
+
+/*
+ * Connected to RangeLineEdit::selectionChanged.
+ * Invoked whenever the QLineEdit's selection changes. We do not was normal selection behavior with this widget,
+ * so it will automatically deselect any selection implicitly. Using keyPressEvents and right click context menu
+ * operations, all behavior relying on selection can be done without messing with the state of the widget.
+ */
+void RangeLineEditBase::selectionChangedEvent(){
+
+    //Prevent selection by the user (Don't worry, this widget still lets you copy and paste properly with Ctrl+C and Ctrl+V)
+    deselect();
+
+}
+
+/*
+ * Copies the current text of this widget to the clipboard
+ */
+void RangeLineEditBase::copyTextToClipboard(){
+
+    QClipboard* clipboard = QGuiApplication::clipboard();
+    if(clipboard != nullptr){
+
+        clipboard->setText(text());
+
+    }
+
+}
+
+/*
+ * Zeroes out all of the RangeInts
+ */
+void RangeLineEditBase::clearText(){
+
+    foreach(RangeInt* rangeInt, m_rangeInts){
+
+        rangeInt->setValue(0LL);
+        rangeInt->m_dirty = true;
+
+    }
+
+    scrapeDirtiedRanges();
+
+}
+
+/* --- Private methods --- */
+
+/*
+ * Starts a BatchUpdate scope. The outermost one remembers the undisplayed precision, so its end can tell whether valueChanged is owed.
+ */
+void RangeLineEditBase::beginBatchUpdate(){
+
+    if(m_batchDepth == 0){
+
+        //Production::Note: The text is rendered from the Ranges, so comparing it covers them. Only the precision it can't show is kept here,
+        //rather than the whole value, so a batch never builds a ValueType (or copies a QString) just to check it
+        m_batchStartPrecision = undisplayedPrecision();
+
+        m_batchPendingFixups     = false;
+        m_batchPendingScrape     = false;
+        m_batchPendingFullScrape = false;
+
+    }
+
+    ++m_batchDepth;
+
+}
+
+/*
+ * Ends a BatchUpdate scope. The outermost one runs the deferred sign sync and maximum clamp (while scrapes are still deferred),
+ * then scrapes once, which emits textChanged (and so valueModified) if the text changed.
+ * If only undisplayed precision changed, the text didn't, so valueModified is emitted directly instead.
+ */
+void RangeLineEditBase::endBatchUpdate(){
+
+    if(m_batchDepth == 1){
+
+        if(m_batchPendingFixups){
+
+            m_batchFlushing = true;
+
+            syncRangeSigns();
+            maximumExceededFixup();
+
+            m_batchFlushing = false;
+
+        }
+
+        m_batchDepth = 0;
+
+        const QString originalText = text();
+
+        //Production::Note: Values set directly on the RangeInts (i.e. setRangeIntMagnitudes(...)) only dirty them, so pending fixups also mean pending text,
+        //even when syncRangeSigns() had no sign to flip and didn't scrape
+        if(m_batchPendingScrape || m_batchPendingFixups){
+
+            scrapeDirtiedRanges(m_batchPendingFullScrape);
+
+        }
+
+        if(originalText == text() && undisplayedPrecision() != m_batchStartPrecision){
+
+            emit valueModified();
+
+        }
+
+    }else if(m_batchDepth > 1){
+
+        --m_batchDepth;
+
+    }
+
+}
+
+/*
+ * Closes a BatchUpdate scope left by an exception. The outermost one runs the same fixups and scrape as endBatchUpdate(),
+ * but with signals blocked, so the text matches value() again without emitting anything while unwinding.
+ */
+void RangeLineEditBase::abandonBatchUpdate(){
+
+    if(m_batchDepth == 1){
+
+        //Production::Note: Restores the previous state, rather than unblocking, in case the caller had blocked signals too
+        const bool signalsWereBlocked = blockSignals(true);
+
+        if(m_batchPendingFixups){
+
+            m_batchFlushing = true;
+
+            syncRangeSigns();
+            maximumExceededFixup();
+
+            m_batchFlushing = false;
+
+        }
+
+        m_batchDepth = 0;
+
+        if(m_batchPendingScrape || m_batchPendingFixups){
+
+            scrapeDirtiedRanges(m_batchPendingFullScrape);
+
+        }
+
+        m_batchPendingFixups     = false;
+        m_batchPendingScrape     = false;
+        m_batchPendingFullScrape = false;
+
+        blockSignals(signalsWereBlocked);
+
+    }else if(m_batchDepth > 1){
+
+        --m_batchDepth;
+
+    }
+
+}
+
+/*
+ * Making QLineEdit::setText private so outside users can't
+ * accidentally improperly call setText, rather than setValue.
+ * Also marks the highlight's character offsets stale.
+ */
+void RangeLineEditBase::setText(const QString& valString){
+
+    //Production::Note: Done here rather than on textChanged, which scrapeDirtiedRanges(...) emits itself and a caller may have blocked
+    m_charOffsetsDirty = true;
+    QLineEdit::setText(valString);
+
+}
@@ -0,0 +1,881 @@
+#ifndef RANGELINEEDITBASE_H
+#define RANGELINEEDITBASE_H
+
+#include <QLineEdit>
+#include <QBasicTimer>
+#include <QColor>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QPixmap>
+#include <QPolygon>
+#include <QPointer>
+#include <QRect>
+#include <QSize>
+#include <QString>
+#include <QVector>
+
+#include "Ranges.h"
+#include "RangePool.h"
+
+#include <exception>
+#include <memory>
+#include <vector>
+
+class QAction;
+class QMenu;
+class QPainter;
+
+/*! struct CursorMapEntry
+ *
+ * What a RangeLineEdit knows about one character position of its text, precomputed by RangeLineEditBase::syncCursorMap().
+ * Production::Note: The map has one extra entry for the position just past the last character, where the cursor can sit.
+ */
+struct CursorMapEntry{
+
+    Range* m_range;            //The Range displayed at this position
+    int    m_localIndex;       //Significant figure's index within m_range (Right to left indexing)
+    int    m_previousEditable; //The position seekLeft() moves to from here
+    int    m_nextEditable;     //The position seekRight() moves to from here
+    bool   m_editable;         //Whether stepping or typing here can change m_range
+
+};
+
+/*! class RangeLineEditBase
+ *
+ * Derived type of QLineEdit, and the compiled, type independent engine of every RangeLineEdit.
+ * Employs the Range type class suite to manage a pseudo RegExpr
+ * for Character and Integer states. It will tether multiple Ranges
+ * together for the user in the order they're pushed back to the internal
+ * list of Ranges. Has the following functionality:
+ *     1. Always guaranteed valid state
+ *     2. Overridden context menu options for:
+ *         a. Copying the text to your clipboard as a string
+ *         b. Copying the text as a decimal to your clipboard as a string
+ *         c. Pasting a valid decimal value
+ *         d. Clearing the value and zeroing all RangeInts
+ *     3. Supports KeyPressEvent for:
+ *         a. Alphanumerics
+ *         b. Up and Down Arrows (Increment and Decrement operations, respectively)
+ *         c. Left and Right Arrows (Seek left and Seek right, respectively)
+ *         d. Backspace and Delete keys
+ *             i.  (Backspace will zero out the current RangeInt index and move cursor left)
+ *             ii. (Delete will zero out the current RangeInt index and move cursor right)
+ *         e. Home and End
+ *         f. Ctrl+C will copy text as decimal to clipboard
+ *
+ * Everything that doesn't depend on the widget's value type lives here, compiled once.
+ * RangeLineEdit<ValueType> only adds the conversions between its Ranges and a ValueType.
+ */
+class RangeLineEditBase : public QLineEdit{
+
+    Q_OBJECT
+
+public:
+
+    /*! class BatchUpdate
+     *
+     * RAII scope that defers every scrape, sign sync and maximum clamp of a RangeLineEdit until the outermost scope ends.
+     * The text is then rendered once, and textChanged and valueChanged are emitted at most once, however many edits were made.
+     * Scopes nest, and deleting the widget inside a scope is safe, nothing is flushed once it's gone.
+     * If the outermost scope is left by an exception, the text is still brought in line with the Ranges (keeping whatever the batch set),
+     * but with signals blocked: nothing is emitted while unwinding, so listeners aren't told about that change.
+     *
+     * Usage example:
+     *     {
+     *         LatitudeLineEdit::BatchUpdate batch(latitudeLineEdit);
+     *         latitudeLineEdit->setValue(47.6);
+     *         latitudeLineEdit->stepBy(5, 2);
+     *     }
+     */
+    class BatchUpdate{
+
+    public:
+
+        /*
+         * Value Constructor
+         * @PARAM RangeLineEditBase* lineEdit - The widget whose updates are deferred until this scope ends
+         */
+        explicit BatchUpdate(RangeLineEditBase* lineEdit)
+            : m_lineEdit          (lineEdit),
+              m_uncaughtExceptions(uncaughtExceptions())
+        {
+
+            m_lineEdit->beginBatchUpdate();
+
+        }
+
+        /*
+         * Destructor
+         * Ends the batch, flushing it if this is the outermost scope, unless the widget was deleted or an exception is unwinding this scope
+         */
+        ~BatchUpdate(){
+
+            if(m_lineEdit.isNull() == false){
+
+                //Production::Note: Destructors are noexcept, so a slot throwing from a flush during unwinding would call std::terminate
+                if(uncaughtExceptions() > m_uncaughtExceptions){
+
+                    m_lineEdit->abandonBatchUpdate();
+
+                }else{
+
+                    m_lineEdit->endBatchUpdate();
+
+                }
+
+            }
+
+        }
+
+        BatchUpdate(const BatchUpdate&)            = delete;
+        BatchUpdate& operator=(const BatchUpdate&) = delete;
+
+    private:
+
+        QPointer<RangeLineEditBase> m_lineEdit;
+        int                         m_uncaughtExceptions;
+
+    };
+
+    /*
+     * Value Constructor
+     * @PARAM QWidget* parent - Standard Qt parenting mechanism for memory management
+     */
+    RangeLineEditBase(QWidget* parent);
+
+    /*
+     * Destructor.
+     * Clears all Range validators.
+     */
+    ~RangeLineEditBase();
+
+    /*
+     * Convenience function for dynamically changing the precision of the decimals.
+     * The decimal Range is retargeted in place, and the current value is re-expressed at the new precision,
+     * so the text is updated (and textChanged and valueChanged emitted) at most once.
+     * @PARAM int decimals - Decimal precision to be displayed. Can be set to 0 which will remove precision values, if already set.
+     */
+    virtual void setPrecision(int decimals);
+
+    /*
+     * Changes the precision of every given widget as one batch. Every widget is updated before any of them renders,
+     * so nothing connected to one of them can observe another at its old precision, and each widget still renders and emits at most once.
+     * Each widget's cursor and updatesEnabled() are restored afterwards, a widget deleted by a slot along the way is skipped, and an exception still closes every batch.
+     * @PARAM const LineEditList& lineEdits - Any iterable container of pointers to RangeLineEdit (or derived) widgets, i.e. QList<LatitudeLineEdit*>
+     * @PARAM int                 decimals  - Decimal precision to be displayed by every widget
+     */
+    template <typename LineEditList>
+    static void setPrecisionForEach(const LineEditList& lineEdits, int decimals){
+
+        //Production::Note: Held through unique_ptr since a PrecisionScope can't be copied or moved, which growing the vector would need
+        std::vector<std::unique_ptr<PrecisionScope>> scopes;
+
+        for(RangeLineEditBase* lineEdit : lineEdits){
+
+            scopes.push_back(std::make_unique<PrecisionScope>(lineEdit));
+
+        }
+
+        for(const std::unique_ptr<PrecisionScope>& scope : scopes){
+
+            if(scope->m_lineEdit.isNull() == false){
+
+                scope->m_lineEdit->setPrecision(decimals);
+
+            }
+
+        }
+
+        //Production::Note: Ended one at a time in the given order, rather than in whatever order the vector destroys them.
+        //If anything above throws, the vector's destructor closes every scope that's left instead
+        for(std::unique_ptr<PrecisionScope>& scope : scopes){
+
+            scope.reset();
+
+        }
+
+    }
+
+    /*
+     * Delegates a call to the proper Range for the given index to call its own Range::setValueForIndex(...)
+     * @PARAM const QChar& value - The String to set at the given index
+     * @PARAM int          index - The index used to lookup the held Range
+     */
+    virtual bool setValueForIndex(const QChar& value, int index);
+
+    /*
+     * Steps the Range at charIndex by steps units of the digit displayed there, carrying, borrowing and clamping in one pass.
+     * However large steps is, the text is updated once and valueChanged is emitted at most once.
+     * Returns true if any Range changed.
+     * @PARAM long long steps     - How many units to step by, negative to step down
+     * @PARAM int       charIndex - The index of the digit to step, which also decides its magnitude (i.e. the tens digit steps by 10s)
+     */
+    virtual bool stepBy(long long steps, int charIndex);
+
+    /*
+     * Convenience function for setting the current active index's color
+     * @PARAM const QColor& highlightColor                - The color to set
+     * @PARAM bool          implicitlyMakeSemiTransparent - Whether or not to implicitly "tint" the provided color by setting its alpha to 75/255
+     */
+    void setActiveIndexHighlightColor(const QColor& highlightColor, bool implicitlyMakeSemiTransparent = true);
+
+    /*
+     * Shows or hides the increment and decrement buttons painted on the right edge of this widget
+     * @PARAM bool visible - Whether the buttons are painted and respond to the mouse
+     */
+    void setStepButtonsVisible(bool visible);
+
+#ifndef QT_NO_DEBUG
+    /*
+     * Debug builds only: turns the step arrow cache off or on for every RangeLineEdit in the process.
+     * While it's off, every repaint fills each arrow's polygon again, so the uncached paint path can be timed against the cached one.
+     * @PARAM bool enabled - Whether step arrows are blitted from the shared pixmap cache (the default) or filled on every repaint
+     */
+    static void setStepArrowCacheEnabled(bool enabled);
+#endif
+
+    //The width the step buttons are kept within as this widget is resized
+    static constexpr int STEP_BUTTON_MINIMUM_WIDTH = 15;
+    static constexpr int STEP_BUTTON_MAXIMUM_WIDTH = 25;
+
+    /*! enum StepButton
+     * Denotes which of the painted step buttons, if any, is under the mouse or held down
+     */
+    enum StepButton{
+        NO_STEP_BUTTON,
+        INCREMENT_STEP_BUTTON,
+        DECREMENT_STEP_BUTTON
+    };
+
+protected:
+
+    /*
+     * Implemented by RangeLineEdit<ValueType>: reads the value, calls applyPrecision(...), then sets the value again,
+     * so it's re-expressed at the new precision. Always called inside a BatchUpdate.
+     * @PARAM int       decimals       - Decimal precision to be displayed (Already validated by setPrecision(...))
+     * @PARAM long long decimalDivisor - The decimal RangeInt's divisor at that precision
+     */
+    virtual void applyPrecisionPreservingValue(int decimals, long long decimalDivisor) = 0;
+
+    /*
+     * Changes the layout to display decimals digits of precision: retargets the decimal RangeInt in place if there already is one,
+     * and only adds or removes the decimal Ranges when the precision is turned on or off.
+     * The values held by the Ranges are left as they were, setPrecision(...) re-expresses the value afterwards.
+     * Overridden by subclasses that need to adjust other Ranges to the new precision.
+     * @PARAM int       decimals       - Decimal precision to be displayed (Already validated by setPrecision(...))
+     * @PARAM long long decimalDivisor - The decimal RangeInt's divisor at that precision
+     */
+    virtual void applyPrecision(int decimals, long long decimalDivisor);
+
+    /*
+     * Returns the divisor of the least significant RangeInt other than the decimal one, which the decimal divisor stacks on top of
+     */
+    long long precisionBaseDivisor();
+
+    /*
+     * Helper function for when a Range changed width without the layout changing otherwise (i.e. the decimal RangeInt after a precision change).
+     * Recomputes the start and end indices of that Range and every Range to its right, dirtying only those, then rebuilds the cursor map.
+     * The Ranges to its left keep their indices, so their text is still copied from the current text by the next scrape.
+     * @PARAM Range* range - The first Range whose width changed
+     */
+    void syncRangeIndicesFrom(::Range* range);
+
+    /*
+     * Helper function for hit-testing the painted step buttons
+     * @PARAM const QPoint& pos - The position in widget coordinates
+     */
+    StepButton stepButtonAt(const QPoint& pos) const;
+
+    /*
+     * Helper function for the rectangle of a step button, or an empty rectangle for NO_STEP_BUTTON
+     * @PARAM StepButton stepButton - The step button to look up
+     */
+    QRect stepButtonRect(StepButton stepButton) const;
+
+    /*
+     * Helper function that keeps track of the step button under the mouse, repainting only when it changes.
+     * The cursor is an arrow over the buttons, rather than the text's I-beam.
+     * @PARAM StepButton stepButton - The step button now under the mouse
+     */
+    void setHoveredStepButton(StepButton stepButton);
+
+    /*
+     * Helper function that rebuilds each character's x-offset from the first one, if the text, font or style changed since they were last built.
+     * Advances are measured once per character per font, so retyping a digit costs a lookup rather than a text measurement.
+     */
+    void syncCharOffsets();
+
+    /*
+     * Whether the highlight is painted at all: while this widget has focus, or a step button is hovered
+     */
+    bool highlightVisible() const;
+
+    /*
+     * Returns the highlight's rectangle around the character at the cursor, or an empty rectangle if the cursor is past the end of the text
+     */
+    QRect highlightRect();
+
+    /*
+     * Helper function that repaints only where the highlight was last painted and where it is now, rather than the whole widget
+     */
+    void updateHighlight();
+
+    /*
+     * Helper function used by paintEvent(...) to paint the step buttons as push button bevels with a triangle facing up or down
+     * @PARAM QPainter& painter - The painter already active on this widget
+     */
+    void paintStepButtons(QPainter& painter);
+
+    /*
+     * Returns the arrow of a step button rendered at size, from a pixmap cache shared by every RangeLineEdit in the process.
+     * Keyed by direction, size, device pixel ratio and color, so once an arrow has been rendered, repainting it is a single blit.
+     * The keys are kept per widget and only rebuilt once the size, device pixel ratio or color they were built for changes.
+     * @PARAM StepButton    stepButton       - Which arrow, up for the increment button and down for the decrement one
+     * @PARAM const QSize&  size             - The step button's size, in device independent pixels
+     * @PARAM qreal         devicePixelRatio - The device pixel ratio of the screen the widget is on
+     * @PARAM const QColor& color            - The arrow's color
+     */
+    QPixmap stepArrowPixmap(StepButton stepButton, const QSize& size, qreal devicePixelRatio, const QColor& color);
+
+    /*
+     * Helper function for the triangle of a step button's arrow within rect
+     * @PARAM StepButton   stepButton - Which arrow, up for the increment button and down for the decrement one
+     * @PARAM const QRect& rect       - The step button's rectangle
+     */
+    static QPolygon stepArrowPolygon(StepButton stepButton, const QRect& rect);
+
+    /*! struct SharedContextMenu
+     *
+     * The one context menu shown by every RangeLineEdit in the process, and its actions.
+     * It isn't connected to any widget, showContextMenu() carries out whichever action exec() returns on the widget it was shown for.
+     */
+    struct SharedContextMenu{
+
+        QPointer<QMenu> m_menu;
+        QAction*        m_copyAsTextToClipBoardAction;
+        QAction*        m_copyAsValueToClipBoardAction;
+        QAction*        m_pasteAsValueFromClipBoardAction;
+        QAction*        m_clearAction;
+
+    };
+
+    /*
+     * Helper function used by the constructor to initialize the context menu policy.
+     * The menu itself is shared, see sharedContextMenu().
+     */
+    void createCustomContextMenu();
+
+    /*
+     * Returns the context menu shared by every RangeLineEdit, building it the first time any of them is right clicked.
+     * Subclasses overriding showContextMenu(...) can enable or disable its actions before calling the base class,
+     * the paste operation is enabled again once the menu closes.
+     */
+    static SharedContextMenu& sharedContextMenu();
+
+#ifndef QT_NO_DEBUG
+    /*
+     * Debug builds only: whether paintStepButtons(...) blits the arrows from the cache, see setStepArrowCacheEnabled(...)
+     */
+    static bool& stepArrowCacheEnabled();
+#endif
+
+    /*
+     * Helper function for returning the given Range for the index in this widget's QLineEdit::text()
+     * A lookup in the cursor map, falling back to the last Range for any index outside of it
+     * @PARAM int index - The index to match against all Range's start and end indices
+     */
+    ::Range* getRangeForIndex(int index);
+
+    /*
+     * Helper function that rebuilds the cursor map from the Ranges' current start and end indices.
+     * Each position records its Range, its significant figure's index and step weight, whether it's editable,
+     * and where seekLeft() and seekRight() move to from it, so cursor navigation and step resolution are array lookups.
+     * Production::Note: Seeking never hops left onto the head Range, it can only be reached by moving onto it one position at a time
+     */
+    void syncCursorMap();
+
+    /*
+     * Helper function for writing the proper string representation of a given Range into its slot of the composed text
+     * @PARAM Range*         range              - The range to scrape the text from, if dirty
+     * @PARAM const QString& currentText        - The displayed text, copied from instead when the Range is clean and still within it
+     * @PARAM QChar*         destination        - The composed text, with room for the whole layout
+     * @PARAM bool           overrideBeingDirty - Scrape the Range's text value, regardless of it being dirty or not
+     */
+    void scrapeTextFromRangeValue(::Range* range, const QString& currentText, QChar* destination, bool overrideBeingDirty = false);
+
+    /*
+     * Helper function for tying the Ranges together properly during initialization and any subsequent calls to setPrecision(...).
+     * This will sync all Range's left and right neighbors properly and initialize their start and end indices as well.
+     */
+    void syncRangeEdges();
+
+    /*
+     * Helper function that rebuilds the per-layout lists (all RangeInts and the head RangeChar)
+     * from m_ranges, so hot paths can iterate them directly instead of testing every Range's type.
+     * Also fills in every Range's layout caches (head, left-most RangeInt and RangeChar, neighboring RangeInts and the non-zero mask),
+     * so none of the Range queries have to walk the list.
+     * Must be called whenever m_ranges is modified, which syncRangeEdges() does for you.
+     * Empties the cursor map, since it may point at removed Ranges until syncRangeEdges() rebuilds it.
+     */
+    void syncRangeLists();
+
+    /*
+     * Helper function that composes the whole text in one pass, delegating a call to scrapeTextFromRangeValue(...) on each held Range,
+     * then hands it to QLineEdit::setText(...) at most once, and not at all if nothing changed.
+     * When the length is unchanged (every edit that isn't a layout change) the cursor is kept where it was, without any cursorPositionChanged.
+     * Deferred until the end of the outermost BatchUpdate, if there is one.
+     * @PARAM bool overrideBeingDirty - Scrape all of the Ranges' text values, regardless of them being dirty or not
+     */
+    void scrapeDirtiedRanges(bool overrideBeingDirty = false);
+
+    /*
+     * Clears all Ranges properly, nulls out the memory, and clears the held list
+     */
+    virtual void clearCurrentValidators();
+
+    /*
+     * Attempts to increment the Range at the current cursor index
+     */
+    virtual void increment();
+
+    /*
+     * Attempts to decrement the Range at the current cursor index
+     */
+    virtual void decrement();
+
+    /*
+     * Attempts to step the Range at the current cursor index by steps units of the digit there, as one update
+     * @PARAM long long steps - How many units to step by, negative to step down
+     */
+    virtual void stepActiveIndexBy(long long steps);
+
+    /*
+     * Helper function for wheelEvent(...) that adds delta to remainder, then takes as many whole steps out of it as it holds.
+     * A change of direction drops whatever was accumulated the other way first.
+     * @PARAM int  delta        - The event's delta, in pixels or in eighths of a degree
+     * @PARAM int  deltaPerStep - How much delta makes up one step
+     * @PARAM int& remainder    - The partial step accumulated so far, in the same unit as delta
+     */
+    long long accumulateWheelDelta(int delta, int deltaPerStep, int& remainder);
+
+    /*
+     * Applies the whole wheel steps accumulated since the last frame as a single stepActiveIndexBy(...)
+     */
+    void applyPendingWheelSteps();
+
+    /*
+     * Steps once in the held step button's direction, by a digit weight that grows the longer the button has been held
+     */
+    void autoRepeatStep();
+
+    /*
+     * Attempts to move the cursor position to the left to the next valid, editable, Range subtype
+     */
+    void seekLeft();
+
+    /*
+     * Attempts to move the cursor position to the right to the next valid, editable, Range subtype
+     */
+    void seekRight();
+
+    /*
+     * Helper function that ensures any changes to the value of a Range will not exceed the maximum allowable set value.
+     * If the maximum is exceeded, the first-most RangeInt will be set to its range and all subsequent RangeInts will be zeroed out.
+     * Deferred until the end of the outermost BatchUpdate, if there is one.
+     */
+    void maximumExceededFixup();
+
+    /*
+     * Implemented by RangeLineEdit<ValueType>: whether the value is at or past the maximum allowable value.
+     * Always false for non-arithmetic value types, which have no maximum.
+     */
+    virtual bool valueExceedsMaximum() = 0;
+
+    /*
+     * Invoked by maximumExceededFixup() after it clamped the Ranges to the maximum allowable value.
+     * Subclasses holding on to precision that isn't displayed should drop it here.
+     */
+    virtual void maximumWasExceeded();
+
+    /*
+     * Ensures if the signage (+/-) changes as a result of the RangeChar being modified,
+     * that all subsequent RangeInt types match the same sign (+/-) for their underlying value.
+     * Only the RangeInts whose sign actually disagrees are flipped (and dirtied), found through the layout's sign masks.
+     * Deferred until the end of the outermost BatchUpdate, if there is one.
+     */
+    void syncRangeSigns();
+
+    /*
+     * Returns a sum of all RangeInts' values / RangeInts' divisors, without the undisplayed precision
+     * The sum is accumulated exactly, as an integer count of the layout's smallest unit (see unitDivisor()), and converted with a single division,
+     * so the result is the same on every platform and compiler. A layout whose divisors don't nest falls back to adding each term in floating point.
+     * Cached until a RangeInt's value or divisor changes (or the layout does), so repeated reads are free.
+     */
+    long double sumRangeInts();
+
+    /*
+     * Returns the divisor of the layout's smallest unit: the largest RangeInt divisor, provided every other RangeInt divisor divides it.
+     * (i.e. 3600 * 10^decimals for D°M'S''.s, 10^decimals for a double, 1 for a phone number)
+     * Every RangeInt is then worth a whole number of units. Returns 0 for a layout whose divisors don't nest.
+     */
+    long long unitDivisor();
+
+    /*
+     * Splits a non-negative magnitude across the RangeInts as an exact count of the layout's smallest unit, clamped to the maximum allowable value.
+     * The RangeInts are left positive, so call syncRangeSigns() afterwards.
+     * Returns the magnitude now displayed, so the caller can keep whatever didn't fit as undisplayed precision.
+     * @PARAM long double magnitude - The absolute value to display
+     */
+    long double setRangeIntMagnitudes(long double magnitude);
+
+    /*
+     * The part of the value that isn't displayed, compared by a BatchUpdate whose text didn't change to tell whether valueChanged is still owed.
+     * Subclasses holding on to precision that isn't displayed should return it here.
+     */
+    virtual long double undisplayedPrecision() const;
+
+    /*
+     * Overridden QKeyEvent
+     * Manages calls to all of the helper functions to change the state of this widget
+     * @PARAM QKeyEvent* keyEvent - Standard Qt QKeyEvent
+     */
+    void keyPressEvent(QKeyEvent* keyEvent) override;
+
+    /*
+     * Overridden QPaintEvent
+     * Calls base class behavior before attemtping to paint a small colored rectangle around
+     * the current cursor's position to denote which index is currently in an editable context
+     * @PARAM QPaintEvent* paintEvent - Standard Qt QPaintEvent
+     */
+    void paintEvent(QPaintEvent* paintEvent) override;
+
+    /*
+     * Overridden QResizeEvent
+     * Modifies the size and position of the increment and decrement push buttons
+     * to always be with respect to this widget's width.
+     * @PARAM QResizeEvent* resizeEvent - Standard Qt QResizeEvent
+     */
+    void resizeEvent(QResizeEvent* resizeEvent) override;
+
+    /*
+     * Overridden QWheelEvent
+     * Accumulates the wheel's angle (or a touchpad's pixel) delta into whole steps up or down for the given active index.
+     * Steps arriving in quick succession are accelerated, and they're applied at most once per frame, so each event only costs some arithmetic.
+     * @PARAM QWheelEvent* wheelEvent - Standard Qt QWheelEvent
+     */
+    void wheelEvent(QWheelEvent* wheelEvent) override;
+
+    /*
+     * Overridden QMouseEvent
+     * A press on a step button steps once and holds it down, auto-repeating like a QSpinBox's arrows. Anything else is handled by QLineEdit as usual
+     * @PARAM QMouseEvent* mouseEvent - Standard Qt QMouseEvent
+     */
+    void mousePressEvent(QMouseEvent* mouseEvent) override;
+
+    /*
+     * Overridden QMouseEvent
+     * Treated as a second press, so a fast double click on a step button steps twice like it would on a QSpinBox
+     * @PARAM QMouseEvent* mouseEvent - Standard Qt QMouseEvent
+     */
+    void mouseDoubleClickEvent(QMouseEvent* mouseEvent) override;
+
+    /*
+     * Overridden QMouseEvent
+     * Releasing a held step button stops its auto-repeat
+     * @PARAM QMouseEvent* mouseEvent - Standard Qt QMouseEvent
+     */
+    void mouseReleaseEvent(QMouseEvent* mouseEvent) override;
+
+    /*
+     * Overridden QMouseEvent
+     * Tracks which step button is hovered (This widget has mouse tracking on while the step buttons are visible)
+     * @PARAM QMouseEvent* mouseEvent - Standard Qt QMouseEvent
+     */
+    void mouseMoveEvent(QMouseEvent* mouseEvent) override;
+
+    /*
+     * Overridden QEvent::leaveEvent
+     * Nothing is hovered once the mouse has left
+     * @PARAM QEvent* leaveEvent - Standard Qt leaveEvent call
+     */
+    void leaveEvent(QEvent* leaveEvent) override;
+
+    /*
+     * Overridden QEvent::changeEvent
+     * Measured character advances are dropped once the font or style changes
+     * @PARAM QEvent* changeEvent - Standard Qt changeEvent call
+     */
+    void changeEvent(QEvent* changeEvent) override;
+
+    /*
+     * Overridden QTimerEvent
+     * Applies the wheel steps accumulated during the last frame, and stops once a frame goes by without any.
+     * Also drives the auto-repeat of a held step button
+     * @PARAM QTimerEvent* timerEvent - Standard Qt QTimerEvent
+     */
+    void timerEvent(QTimerEvent* timerEvent) override;
+
+protected slots:
+
+    /*
+     * Connected to RangeLineEditBase::customContextMenuRequested.
+     * Invoked on a right click event and spawns the shared context menu, then carries out the chosen action on this widget.
+     * @PARAM const QPoint& pos - The position in widget coordinates that gets mapped to global coordinates to display the context menu at
+     */
+    virtual void showContextMenu(const QPoint& pos);
+
+    /*
+     * Connected to RangeLineEditBase::cursorPositionChanged.
+     * Invoked whenever the cursor position was changed.
+     * Ensures the cursor is only ever on top of an editable Range.
+     * @PARAM int prev - Unused (But used to match QLineEdit's signal arguments)
+     * @PARAM int cur  - The new position requested by either the user or done programmatically via setCursorPosition()
+     */
+    void cursorPositionChangedEvent(int, int cur);
+
+    /*
+     * Connected to RangeLineEditBase::selectionChanged.
+     * Invoked whenever the QLineEdit's selection changes. We do not was normal selection behavior with this widget,
+     * so it will automatically deselect any selection implicitly. Using keyPressEvents and right click context menu
+     * operations, all behavior relying on selection can be done without messing with the state of the widget.
+     */
+    void selectionChangedEvent();
+
+    /*
+     * Copies the current text of this widget to the clipboard
+     */
+    void copyTextToClipboard();
+
+    /*
+     * Pure virtual function that every subclass needs to define to allow Ctrl+C to work.
+     * Production::Note: If a subclass has no needs for this behavior, just NOP it
+     */
+    virtual void copyValueToClipboard() = 0;
+
+    /*
+     * Pure virtual function that every subclass needs to define to allow Ctrl+V to work.
+     * Production::Note: If a subclass has no needs for this behavior, just NOP it
+     */
+    virtual void pasteValueFromClipboard() = 0;
+
+    /*
+     * Zeroes out all of the RangeInts
+     */
+    virtual void clearText();
+
+signals:
+
+    /*
+     * Type independent counterpart of each subclass' valueChanged(ValueType), emitted at the same moments:
+     * whenever the text changes, or a BatchUpdate changed only the undisplayed precision.
+     * Subclasses re-emit it as their typed valueChanged, and anything handling several kinds of RangeLineEdit can connect to it directly.
+     */
+    void valueModified();
+
+private:
+
+    /*! class PrecisionScope
+     *
+     * One widget's share of setPrecisionForEach(...): a BatchUpdate with its repaints suspended,
+     * that puts the cursor and the widget's own updatesEnabled() back once the batch has ended.
+     * Nothing is restored if a slot deleted the widget, and the cursor is put back with signals blocked while an exception is unwinding.
+     */
+    class PrecisionScope{
+
+    public:
+
+        /*
+         * Value Constructor
+         * @PARAM RangeLineEditBase* lineEdit - The widget whose precision is about to change
+         */
+        explicit PrecisionScope(RangeLineEditBase* lineEdit)
+            : m_lineEdit          (lineEdit),
+              m_batch             (std::make_unique<BatchUpdate>(lineEdit)),
+              m_cursorPosition    (lineEdit->cursorPosition()),
+              m_updatesEnabled    (lineEdit->updatesEnabled()),
+              m_uncaughtExceptions(uncaughtExceptions())
+        {
+
+            m_lineEdit->setUpdatesEnabled(false);
+
+        }
+
+        /*
+         * Destructor
+         * Ends the batch first, since that's when the text changes length, then restores the cursor and updatesEnabled()
+         */
+        ~PrecisionScope(){
+
+            const bool unwinding(uncaughtExceptions() > m_uncaughtExceptions);
+
+            m_batch.reset();
+
+            if(m_lineEdit.isNull() == false){
+
+                //Production::Note: cursorPositionChanged's slots could throw, which would call std::terminate while unwinding
+                const bool signalsWereBlocked(m_lineEdit->blockSignals(unwinding || m_lineEdit->signalsBlocked()));
+                m_lineEdit->setCursorPosition(m_cursorPosition);
+                m_lineEdit->blockSignals(signalsWereBlocked);
+
+                m_lineEdit->setUpdatesEnabled(m_updatesEnabled);
+
+            }
+
+        }
+
+        PrecisionScope(const PrecisionScope&)            = delete;
+        PrecisionScope& operator=(const PrecisionScope&) = delete;
+
+        QPointer<RangeLineEditBase>  m_lineEdit;
+        std::unique_ptr<BatchUpdate> m_batch;
+        int                          m_cursorPosition;
+        bool                         m_updatesEnabled;
+        int                          m_uncaughtExceptions;
+
+    };
+
+    /*
+     * Helper function for how many exceptions are in flight, so a scope's destructor can tell whether it's being run by one unwinding that scope
+     */
+    static int uncaughtExceptions(){
+
+#if defined(__cpp_lib_uncaught_exceptions)
+        return std::uncaught_exceptions();
+#else
+        return std::uncaught_exception() ? 1 : 0;
+#endif
+
+    }
+
+    /*
+     * Starts a BatchUpdate scope. The outermost one remembers the undisplayed precision, so its end can tell whether valueChanged is owed.
+     */
+    void beginBatchUpdate();
+
+    /*
+     * Ends a BatchUpdate scope. The outermost one runs the deferred sign sync and maximum clamp (while scrapes are still deferred),
+     * then scrapes once, which emits textChanged (and so valueModified) if the text changed.
+     * If only undisplayed precision changed, the text didn't, so valueModified is emitted directly instead.
+     */
+    void endBatchUpdate();
+
+    /*
+     * Closes a BatchUpdate scope left by an exception. The outermost one runs the same fixups and scrape as endBatchUpdate(),
+     * but with signals blocked, so the text matches value() again without emitting anything while unwinding.
+     */
+    void abandonBatchUpdate();
+
+    /*
+     * Making QLineEdit::setText private so outside users can't
+     * accidentally improperly call setText, rather than setValue.
+     * Also marks the highlight's character offsets stale.
+     * @PARAM const QString& valString - The value the base class will show
+     */
+    void setText(const QString& valString);
+
+    //The undisplayed precision when the outermost BatchUpdate began, so its end can tell whether valueChanged is owed
+    long double m_batchStartPrecision;
+
+public:
+
+    //Owns the memory of every Range in m_ranges, create and destroy them through it rather than new / delete
+    RangePool       m_rangePool;
+    QList<::Range*> m_ranges;
+
+    //Per-layout lists rebuilt by syncRangeLists() whenever m_ranges changes
+    QVector<RangeInt*> m_rangeInts;
+    RangeChar*         m_rangeChar;
+
+    //One entry per character position (plus one past the end), rebuilt by syncCursorMap() whenever the layout changes
+    QVector<CursorMapEntry> m_cursorMap;
+
+    //Bit i is set while the i-th RangeInt is non-zero, shared with every Range through Range::m_nonZeroRangeInts
+    quint64            m_nonZeroRangeInts;
+
+    //Bit i is set while the i-th RangeInt is negative, shared through Range::m_negativeRangeInts.
+    //Once the sign has been propagated it's either 0 or equal to m_nonZeroRangeInts, so syncRangeSigns() can spot a RangeInt that disagrees without visiting any
+    quint64            m_negativeRangeInts;
+
+    //Bumped through Range::m_valueRevision whenever a RangeInt's value or divisor changes, and by syncRangeLists().
+    //sumRangeInts() is only recomputed when it no longer matches the revision the cache was taken at
+    quint64            m_valueRevision;
+    quint64            m_sumRangeIntsRevision;
+    long double        m_sumRangeIntsCache;
+
+    //Reused by scrapeDirtiedRanges() to compose the whole text before a single QLineEdit::setText(...)
+    QString            m_textBuffer;
+
+    //BatchUpdate state: how many scopes are open, and the work deferred until the outermost one ends (RangeLineEdit<ValueType> keeps the original value)
+    int                m_batchDepth;
+    bool               m_batchPendingFixups;
+    bool               m_batchPendingScrape;
+    bool               m_batchPendingFullScrape;
+    bool               m_batchFlushing;
+
+    //This determines if m_decimalRange should exist
+    int       m_decimals;
+    long long m_maxAllowableValue;
+    int       m_prevCursorPosition;
+
+    //The step buttons are painted by paintEvent(...) rather than being child widgets, resizeEvent(...) lays out their rectangles
+    bool       m_stepButtonsVisible;
+    QRect      m_incrementButtonRect;
+    QRect      m_decrementButtonRect;
+    StepButton m_hoveredStepButton;
+    StepButton m_pressedStepButton;
+
+    //A mouse wheel notch is 120 eighths of a degree, a touchpad scrolls one step per WHEEL_PIXELS_PER_STEP pixels.
+    //Every WHEEL_ACCELERATION_RAMP whole steps in a row arriving within WHEEL_ACCELERATION_WINDOW_MS of each other add another multiple, up to WHEEL_MAXIMUM_ACCELERATION
+    static constexpr int WHEEL_ANGLE_PER_STEP         = 120;
+    static constexpr int WHEEL_PIXELS_PER_STEP        = 20;
+    static constexpr int WHEEL_FRAME_INTERVAL_MS      = 16;
+    static constexpr int WHEEL_ACCELERATION_WINDOW_MS = 50;
+    static constexpr int WHEEL_ACCELERATION_RAMP      = 4;
+    static constexpr int WHEEL_MAXIMUM_ACCELERATION   = 8;
+
+    //Wheel state: the partial steps accumulated so far, the whole steps waiting for the next frame,
+    //and how many whole steps in a row came in quickly (timed by m_wheelClock)
+    int           m_wheelAngleRemainder;
+    int           m_wheelPixelRemainder;
+    long long     m_pendingWheelSteps;
+    int           m_wheelStreak;
+    QElapsedTimer m_wheelClock;
+    QBasicTimer   m_wheelFrameTimer;
+
+    //A held step button steps on the press, then once per frame after AUTO_REPEAT_DELAY_MS.
+    //Every AUTO_REPEAT_DECADE_MS of repeating moves it up to the next digit weight (1, 10, 100, ...), up to AUTO_REPEAT_MAXIMUM_DECADES of them
+    static constexpr int AUTO_REPEAT_DELAY_MS        = 300;
+    static constexpr int AUTO_REPEAT_INTERVAL_MS     = 16;
+    static constexpr int AUTO_REPEAT_DECADE_MS       = 250;
+    static constexpr int AUTO_REPEAT_MAXIMUM_DECADES = 6;
+
+    //Auto-repeat state: the timer for the initial delay and then every repeat, and how long it's been repeating (invalid during the delay)
+    QBasicTimer   m_autoRepeatTimer;
+    QElapsedTimer m_autoRepeatClock;
+
+    //The shared pixmap cache's keys for this widget's step arrows, and the size, device pixel ratio and color they were built for (see stepArrowPixmap(...))
+    QString m_incrementArrowKey;
+    QString m_decrementArrowKey;
+    QSize   m_stepArrowKeySize;
+    qreal   m_stepArrowKeyDpr;
+    QRgb    m_stepArrowKeyColor;
+
+    RangeStringConstant* m_decimalString;
+    RangeInt*            m_decimalRange;
+
+    QColor m_highlightColor;
+
+    //Highlight geometry, so paintEvent(...) doesn't measure any text: every character's x-offset from the first (plus one past the end),
+    //rebuilt by syncCharOffsets() after the text changes, from advances measured once per character and dropped with the font or style
+    QVector<int>      m_charOffsets;
+    QHash<QChar, int> m_charAdvances;
+    int               m_charHeight;
+    bool              m_charOffsetsDirty;
+
+    //Where the highlight was last painted, so moving it only repaints the old and new rectangles
+    QRect             m_highlightRect;
+
+};
+
+#endif // RANGELINEEDITBASE_H
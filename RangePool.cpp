@@ -0,0 +1,100 @@
+#include "RangePool.h"
+
+#include <algorithm>
+#include <functional>
+
+//Production::Note: Out-of-line definitions, since std::min / std::max bind these by reference (Pre-C++17 they aren't implicitly inline)
+const int RangePool::DEFAULT_CAPACITY;
+const int RangePool::MAXIMUM_CAPACITY;
+
+/*
+ * Value Constructor
+ */
+RangePool::RangePool(int capacity)
+    : m_slots    (nullptr),
+      m_capacity (std::min(std::max(capacity, 0), MAXIMUM_CAPACITY)),
+      m_usedSlots(0ULL)
+{
+
+    /* NOP */
+
+}
+
+/*
+ * Destructor
+ * Releases the slot buffer. Any Range still alive in the pool must already have been destroyed.
+ */
+RangePool::~RangePool(){
+
+    Q_ASSERT(m_usedSlots == 0ULL);
+
+    delete[] m_slots;
+    m_slots = nullptr;
+
+}
+
+/*
+ * Destroys a Range created by create(...), returning its slot to the pool (or deleting it, if it had to be heap allocated).
+ * Does nothing for nullptr.
+ */
+void RangePool::destroy(Range* range){
+
+    if(range == nullptr){
+
+        return;
+
+    }
+
+    if(owns(range)){
+
+        //Production::Note: Range's destructor is virtual, so this runs the whole subclass's destructor
+        const int slotIndex = static_cast<int>(reinterpret_cast<const Slot*>(range) - m_slots);
+        range->~Range();
+        m_usedSlots &= ~(1ULL << slotIndex);
+
+    }else{
+
+        delete range;
+
+    }
+
+}
+
+/*
+ * Returns true if range lives in one of this pool's slots
+ */
+bool RangePool::owns(const Range* range) const{
+
+    //Production::Note: Compared through std::less, since relational operators on unrelated pointers are unspecified
+    const Slot* slot = reinterpret_cast<const Slot*>(range);
+
+    return m_slots != nullptr && !std::less<const Slot*>()(slot, m_slots) && std::less<const Slot*>()(slot, m_slots + m_capacity);
+
+}
+
+/*
+ * Hands out the first free slot, allocating the buffer on first use.
+ * Returns nullptr if every slot is taken.
+ */
+void* RangePool::acquireSlot(){
+
+    if(m_slots == nullptr && m_capacity > 0){
+
+        m_slots = new Slot[m_capacity];
+
+    }
+
+    for(int i = 0; i < m_capacity; ++i){
+
+        if((m_usedSlots & (1ULL << i)) == 0ULL){
+
+            m_usedSlots |= (1ULL << i);
+            return &m_slots[i];
+
+        }
+
+    }
+
+    return nullptr;
+
+}
@@ -0,0 +1,96 @@
+#ifndef RANGEPOOL_H
+#define RANGEPOOL_H
+
+#include "Ranges.h"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*! class RangePool
+ *
+ * Contiguous, per-widget storage for the Ranges making up a RangeLineEdit's layout.
+ * Every Range subclass fits in one fixed-size slot, and all of the slots live in a single buffer that's allocated
+ * the first time a Range is created. A layout's Ranges then sit next to each other in memory instead of being
+ * scattered across one heap allocation apiece, so walking them stays within a few cache lines.
+ *
+ * Slots are recycled when a Range is destroyed (i.e. when the precision or the country code changes).
+ * A layout that outgrows the pool falls back to the heap, so dynamic layouts still have no hard limit.
+ *
+ * Production::Note: Ranges created by a RangePool must be destroyed by that same RangePool, never with delete.
+ */
+class RangePool{
+
+public:
+
+    //Every slot is large and aligned enough to hold any Range subclass
+    typedef std::aligned_union<0, RangeChar, RangeStringConstant, RangeInt>::type Slot;
+
+    //The largest built-in layout (latitude / longitude with decimals) uses 9 Ranges
+    static const int DEFAULT_CAPACITY = 16;
+
+    //Free slots are tracked with one bit apiece
+    static const int MAXIMUM_CAPACITY = 64;
+
+    /*
+     * Value Constructor
+     * @PARAM int capacity - How many Ranges the pool holds before falling back to the heap (Limited to MAXIMUM_CAPACITY)
+     */
+    explicit RangePool(int capacity = DEFAULT_CAPACITY);
+
+    /*
+     * Destructor
+     * Releases the slot buffer. Any Range still alive in the pool must already have been destroyed.
+     */
+    ~RangePool();
+
+    RangePool(const RangePool&)            = delete;
+    RangePool& operator=(const RangePool&) = delete;
+
+    /*
+     * Constructs a RangeType in a free slot, or on the heap if every slot is taken.
+     * @PARAM Args&&... args - Forwarded to RangeType's constructor
+     */
+    template <typename RangeType, typename... Args>
+    RangeType* create(Args&&... args){
+
+        static_assert(std::is_base_of<Range, RangeType>::value, "RangePool can only hold Range types");
+        static_assert(sizeof(RangeType) <= sizeof(Slot) && alignof(RangeType) <= alignof(Slot), "Range type doesn't fit in a RangePool::Slot");
+
+        void* slot = acquireSlot();
+        if(Q_UNLIKELY(slot == nullptr)){
+
+            return new RangeType(std::forward<Args>(args)...);
+
+        }
+
+        return new (slot) RangeType(std::forward<Args>(args)...);
+
+    }
+
+    /*
+     * Destroys a Range created by create(...), returning its slot to the pool (or deleting it, if it had to be heap allocated).
+     * Does nothing for nullptr.
+     * @PARAM Range* range - The Range to destroy
+     */
+    void destroy(Range* range);
+
+    /*
+     * Returns true if range lives in one of this pool's slots
+     * @PARAM const Range* range - The Range to look up
+     */
+    bool owns(const Range* range) const;
+
+    /*
+     * Hands out the first free slot, allocating the buffer on first use.
+     * Returns nullptr if every slot is taken.
+     */
+    void* acquireSlot();
+
+    Slot*   m_slots;
+    int     m_capacity;
+    quint64 m_usedSlots;
+
+};
+
+#endif // RANGEPOOL_H
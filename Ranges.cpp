@@ -1,21 +1,32 @@
 #include "Ranges.h"
+#include "IntegerMath.h"
 
-#include <QRegExp>
+#include <QVector>
 
+#include <algorithm>
 #include <iostream>
-#include <cmath>
 
 /* --- Range definitions --- */
 
 /*
- * Default Constructor
+ * Value Constructor
  */
-Range::Range()
-    : m_charIndexStart(0),
-      m_charIndexEnd  (0),
-      m_leftRange     (nullptr),
-      m_rightRange    (nullptr),
-      m_dirty         (false)
+Range::Range(Kind kind)
+    : m_leftRange        (nullptr),
+      m_rightRange       (nullptr),
+      m_headRange        (nullptr),
+      m_leftMostRangeInt (nullptr),
+      m_leftMostRangeChar(nullptr),
+      m_previousRangeInt (nullptr),
+      m_nextRangeInt     (nullptr),
+      m_nonZeroRangeInts (nullptr),
+      m_negativeRangeInts(nullptr),
+      m_valueRevision    (nullptr),
+      m_charIndexStart   (0),
+      m_charIndexEnd     (0),
+      m_rangeIntsToLeft  (0),
+      m_kind             (kind),
+      m_dirty            (false)
 {
 
     /* NOP */
@@ -39,6 +50,12 @@ Range::~Range(){
  */
 Range* Range::leftMostRange(){
 
+    if(m_headRange != nullptr){
+
+        return (m_headRange != this) ? m_headRange : nullptr;
+
+    }
+
     Range* range = m_leftRange;
     while(range != nullptr && range->m_leftRange != nullptr){
 
@@ -57,12 +74,18 @@ Range* Range::leftMostRange(){
  */
 RangeInt* Range::leftMostRangeInt(){
 
-    RangeInt* rangeInt  = dynamic_cast<RangeInt*>(this);
+    if(m_headRange != nullptr){
+
+        return m_leftMostRangeInt;
+
+    }
+
+    RangeInt* rangeInt  = m_kind == RANGE_INT ? static_cast<RangeInt*>(this) : nullptr;
     Range*    rangeIter = this->m_leftRange;
     while(rangeIter != nullptr){
 
         //Production::Note: We don't break because we might find another, more left RangeInt
-        if(rangeIter->rangeType() == "RangeInt"){
+        if(rangeIter->m_kind == RANGE_INT){
 
             rangeInt = static_cast<RangeInt*>(rangeIter);
 
@@ -82,13 +105,19 @@ RangeInt* Range::leftMostRangeInt(){
  */
 bool Range::allValuesToLeftAreZero(){
 
+    if(m_nonZeroRangeInts != nullptr && m_rangeIntsToLeft < 64){
+
+        return (*m_nonZeroRangeInts & ((1ULL << m_rangeIntsToLeft) - 1ULL)) == 0ULL;
+
+    }
+
     //Assume true and prove otherwise
     bool allRangeIntsToLeftAreZero(true);
     Range* rangeIter = this->m_leftRange;
     while(rangeIter != nullptr){
 
         //Production::Note: We don't break because we might find another, more left RangeInt
-        if(rangeIter->rangeType() == "RangeInt"){
+        if(rangeIter->m_kind == RANGE_INT){
 
             allRangeIntsToLeftAreZero &= (static_cast<RangeInt*>(rangeIter)->m_value == 0LL);
 
@@ -108,12 +137,18 @@ bool Range::allValuesToLeftAreZero(){
  */
 bool Range::leftMostRangeCharSign(){
 
+    if(m_headRange != nullptr){
+
+        return (m_leftMostRangeChar == nullptr) || (m_leftMostRangeChar->m_value == m_leftMostRangeChar->m_positiveChar);
+
+    }
+
     //Assume true and prove otherwise
     bool positiveSign(true);
     Range* rangeIter = this->m_leftRange;
     while(rangeIter != nullptr){
 
-        if(rangeIter->rangeType() == "RangeChar"){
+        if(rangeIter->m_kind == RANGE_CHAR){
 
             positiveSign = (static_cast<RangeChar*>(rangeIter)->m_value == static_cast<RangeChar*>(rangeIter)->m_positiveChar);
 
@@ -127,13 +162,57 @@ bool Range::leftMostRangeCharSign(){
 
 }
 
+/*
+ * Returns the closest RangeInt to the left of this Range, or nullptr if there isn't one.
+ */
+RangeInt* Range::previousRangeInt(){
+
+    if(m_headRange != nullptr){
+
+        return m_previousRangeInt;
+
+    }
+
+    Range* rangeIter = m_leftRange;
+    while(rangeIter != nullptr && rangeIter->m_kind != RANGE_INT){
+
+        rangeIter = rangeIter->m_leftRange;
+
+    }
+
+    return static_cast<RangeInt*>(rangeIter);
+
+}
+
+/*
+ * Returns the closest RangeInt to the right of this Range, or nullptr if there isn't one.
+ */
+RangeInt* Range::nextRangeInt(){
+
+    if(m_headRange != nullptr){
+
+        return m_nextRangeInt;
+
+    }
+
+    Range* rangeIter = m_rightRange;
+    while(rangeIter != nullptr && rangeIter->m_kind != RANGE_INT){
+
+        rangeIter = rangeIter->m_rightRange;
+
+    }
+
+    return static_cast<RangeInt*>(rangeIter);
+
+}
+
 /* --- RangeChar definitions --- */
 
 /*
  * Value Constructor
  */
 RangeChar::RangeChar(QChar negativeChar, QChar positiveChar)
-    : Range         (),
+    : Range         (RANGE_CHAR),
       m_negativeChar(negativeChar),
       m_positiveChar(positiveChar),
       m_value       (m_positiveChar)
@@ -191,6 +270,27 @@ bool RangeChar::decrement(int){
 
 }
 
+/*
+ * Flips to the positive state for positive steps, or to the negative state for negative steps.
+ * Returns false if steps is 0 or the state didn't change.
+ */
+bool RangeChar::stepBy(long long steps, int){
+
+    bool stepped(false);
+    if(steps > 0LL){
+
+        stepped = increment(0);
+
+    }else if(steps < 0LL){
+
+        stepped = decrement(0);
+
+    }
+
+    return stepped;
+
+}
+
 /*
  * Should always return 1, since this represents a QChar
  */
@@ -220,7 +320,7 @@ QString RangeChar::valueStr(){
 
 /*
  * Returns "RangeChar"
- * Used to avoid dynamic casting whenever possible
+ * Production::Note: Kept for diagnostics only, dispatch on m_kind instead
  */
 QString RangeChar::rangeType(){
 
@@ -246,13 +346,16 @@ bool RangeChar::setValueForIndex(const QChar &value, int index){
 
     bool valueWasSet = false;
 
+    //Fold each character's case once, rather than per comparison
+    const QChar lowerValue = value.toLower();
+
     //Lazily evaluate
-    if( (index == m_charIndexEnd) && (value.toLower() != m_value.toLower()) ){
+    if( (index == m_charIndexEnd) && (lowerValue != m_value.toLower()) ){
 
         //Check case insensitively
-        if( (value.toLower() == m_positiveChar.toLower()) || (value.toLower() == m_negativeChar.toLower()) ){
+        if( (lowerValue == m_positiveChar.toLower()) || (lowerValue == m_negativeChar.toLower()) ){
 
-            m_value     = m_value.isUpper() ? value.toUpper() : value.toLower();
+            m_value     = m_value.isUpper() ? value.toUpper() : lowerValue;
             m_dirty     = true;
             valueWasSet = true;
 
@@ -270,7 +373,7 @@ bool RangeChar::setValueForIndex(const QChar &value, int index){
  * Value Constructor
  */
 RangeStringConstant::RangeStringConstant(const QString& stringPlaceHolder)
-    : Range  (),
+    : Range  (RANGE_STRING_CONSTANT),
       m_value(stringPlaceHolder)
 {
 
@@ -311,6 +414,23 @@ bool RangeStringConstant::decrement(int){
 
 }
 
+/*
+ * Unused by this type.
+ * Forwards the call to its left Range's least significant figure, otherwise will always return true.
+ */
+bool RangeStringConstant::stepBy(long long steps, int){
+
+    bool stepped(true);
+    if(m_leftRange != nullptr){
+
+        stepped = m_leftRange->stepBy(steps, 0);
+
+    }
+
+    return stepped;
+
+}
+
 /*
  * Returns the length of the string this Range was constructed with
  */
@@ -340,7 +460,7 @@ QString RangeStringConstant::valueStr(){
 
 /*
  * Returns "RangeStringConstant"
- * Used to avoid dynamic casting whenever possible
+ * Production::Note: Kept for diagnostics only, dispatch on m_kind instead
  */
 QString RangeStringConstant::rangeType(){
 
@@ -371,14 +491,114 @@ bool RangeStringConstant::setValueForIndex(const QChar&, int){
 
 /* --- RangeInt definitions --- */
 
+/*
+ * Helper function that returns how many decimal digits are needed to print value (0 prints as a single digit)
+ */
+static int digitCount(unsigned long long value){
+
+    int digits(1);
+    while(value >= 10ULL){
+
+        value /= 10ULL;
+        ++digits;
+
+    }
+
+    return digits;
+
+}
+
+/*
+ * Helper function that writes value into destination as exactly width digits, left padded with '0'.
+ * The caller guarantees that destination can hold width characters and that value fits in width digits.
+ */
+static void writePaddedDigits(unsigned long long value, int width, QChar* destination){
+
+    for(int i = width - 1; i >= 0; --i){
+
+        destination[i] = QChar('0' + static_cast<int>(value % 10ULL));
+        value /= 10ULL;
+
+    }
+
+}
+
+//The widest range that gets a pre-padded table, which covers the common ranges 59, 90, 180, 999 and 9999
+static const int MAX_TABULATED_RANGE_LENGTH = 4;
+
+/*
+ * Helper function for paddedDigitTable(...) that builds the table of every value representable in width digits, pre-padded with '0'
+ */
+static QVector<QString> buildPaddedDigitTable(int width){
+
+    int entries(1);
+    for(int i = 0; i < width; ++i){
+
+        entries *= 10;
+
+    }
+
+    QChar            buffer[MAX_TABULATED_RANGE_LENGTH];
+    QVector<QString> table;
+    table.reserve(entries);
+
+    for(int value = 0; value < entries; ++value){
+
+        writePaddedDigits(static_cast<unsigned long long>(value), width, buffer);
+        table << QString(buffer, width);
+
+    }
+
+    return table;
+
+}
+
+/*
+ * Helper function for paddedDigitTable(...) that holds the table of one width
+ * Production::Note: A function-local static is initialized exactly once, even when several threads format at the same time (C++11)
+ */
+template <int Width>
+static const QVector<QString>& paddedDigitTableOfWidth(){
+
+    static const QVector<QString> table(buildPaddedDigitTable(Width));
+    return table;
+
+}
+
+/*
+ * Helper function that returns the process-wide table of every value representable in width digits, pre-padded with '0'.
+ * Each table is built once, on first use, and shared by every RangeInt of that width.
+ * Copying a QString out of the table only bumps its reference count, so formatting becomes a lookup.
+ * Returns nullptr for a width that isn't tabulated, which callers format without a table.
+ */
+static const QVector<QString>* paddedDigitTable(int width){
+
+    static_assert(MAX_TABULATED_RANGE_LENGTH == 4, "paddedDigitTable(...) needs a case for every tabulated width");
+
+    switch(width){
+
+        case 1:  return &paddedDigitTableOfWidth<1>();
+        case 2:  return &paddedDigitTableOfWidth<2>();
+        case 3:  return &paddedDigitTableOfWidth<3>();
+        case 4:  return &paddedDigitTableOfWidth<4>();
+
+        default:
+            Q_ASSERT_X(false, "paddedDigitTable", "width isn't between 1 and MAX_TABULATED_RANGE_LENGTH");
+            return nullptr;
+
+    }
+
+}
+
 /*
  * Value Constructor
  */
 RangeInt::RangeInt(long long range, long long divisor, bool carryOrBorrowFromLeft, bool isSigned)
-    : Range                  (),
+    : Range                  (RANGE_INT),
       m_range                (1LL),
       m_value                (0LL),
       m_divisor              (divisor),
+      m_rangeLength          (1),
       m_carryOrBorrowFromLeft(carryOrBorrowFromLeft),
       m_signed               (isSigned)
 {
@@ -397,14 +617,22 @@ bool RangeInt::setRange(long long range){
 
     if(range > 0LL){
 
-        m_range = range;
+        m_range       = range;
+        m_rangeLength = digitCount(static_cast<unsigned long long>(m_range));
         if(m_value > m_range){
 
             m_value = m_range;
             m_dirty = true;
 
+        }else if(m_value < -m_range){
+
+            m_value = -m_range;
+            m_dirty = true;
+
         }
 
+        syncLayoutState();
+
     }else{
 
         std::cerr << QString("Error. RangeInt::setRange(long long range = %0) must be called with a range > 0.").arg(range).toStdString() << std::endl;
@@ -427,6 +655,7 @@ bool RangeInt::setDivisor(long long divisor){
     if(divisor > 0LL){
 
         m_divisor = divisor;
+        syncLayoutState();
 
     }else{
 
@@ -443,9 +672,12 @@ bool RangeInt::setDivisor(long long divisor){
  * Convenience function to help set the value, while ensuring the range limits are being observed, when either positive or negative.
  * For example, if the value is 70, but our range is 59, this will truncate the value to just set 59.
  * This will always be called before adjacent Ranges were incremented accordingly due to what this value is attempting to become.
+ * Marks the Range dirty if its value changed.
  */
 void RangeInt::setValue(long long value){
 
+    const long long previousValue = m_value;
+
     m_value = value;
 
     //If it's unsigned and less than 0, then 0 it out
@@ -465,284 +697,223 @@ void RangeInt::setValue(long long value){
 
     }
 
-}
+    if(m_value != previousValue){
 
-/*
- * Helper function for dealing with over and underflow
- */
-long long safeAdd(long long a, long long b){
-
-    long long retVal = 0LL;
-    if(a > 0 && b > LLONG_MAX - a){
-
-        retVal = LLONG_MAX;
-
-    }else if (a < 0 && b < LLONG_MIN - a){
-
-        retVal = LLONG_MIN;
-
-    }else{
-
-        retVal = a + b;
+        m_dirty = true;
 
     }
 
-    return retVal;
+    syncLayoutState();
 
 }
 
 /*
- * Will increment the value at the significant figure's index.
- * If this value overflows above its maximum range, it will attempt to carry the increment operation
- * over to a Range to its left, if possible.
+ * Updates the layout's shared state after m_value changed:
+ * sets or clears this RangeInt's bit in the non-zero and negative masks to match m_value, and bumps the value revision.
  */
-bool RangeInt::increment(int index){
+void RangeInt::syncLayoutState(){
 
-    //Production::Note: The index refers to the significant figure index (right to left indexing)
-    //This determines if we're at the "ones", "tens", "hundreds", etc. place to determine
-    //what this widget will increment by
+    const quint64 bit = (m_rangeIntsToLeft < 64) ? (1ULL << m_rangeIntsToLeft) : 0ULL;
 
-    long long valueToIncrementBy = std::pow(10LL, index);
-    long long originalValue      = m_value;
+    if(m_nonZeroRangeInts != nullptr){
 
-    //Incrementing a positive number (Should make the number diverge from 0 (i.e. 20 + 10 = 30)
-    if(m_value > 0LL){
+        *m_nonZeroRangeInts = (m_value != 0LL) ? (*m_nonZeroRangeInts | bit) : (*m_nonZeroRangeInts & ~bit);
 
-        if(safeAdd(m_value, valueToIncrementBy) > m_range){
+    }
 
-            if(m_leftRange != nullptr && m_carryOrBorrowFromLeft){
+    if(m_negativeRangeInts != nullptr){
 
-                //If we can increment our left Range
-                if(m_leftRange->increment(0)){
+        *m_negativeRangeInts = (m_value < 0LL) ? (*m_negativeRangeInts | bit) : (*m_negativeRangeInts & ~bit);
 
-                    setValue(m_value + (valueToIncrementBy - m_range - 1LL));
+    }
 
-                }
-                //We've hit our maximum value if we couldn't increment recursively
-                else{
+    if(m_valueRevision != nullptr){
 
-                    setValue(m_range);
+        ++*m_valueRevision;
 
-                }
+    }
 
-            }
-            //We've hit our maximum value if we couldn't increment recursively
-            else{
+}
 
-                setValue(m_range);
+/*
+ * Helper function that returns the next less significant RangeInt sharing rangeInt's carry chain, or nullptr at the chain's tail.
+ * A RangeInt constructed without carryOrBorrowFromLeft starts a new chain.
+ */
+static RangeInt* nextCarryRangeInt(RangeInt* rangeInt){
 
-            }
+    RangeInt* next = rangeInt->nextRangeInt();
 
-        }
-        //Else we don't have an addition carry, so we can just normally add and not affect our neighboring left range
-        else{
+    return (next != nullptr && next->m_carryOrBorrowFromLeft) ? next : nullptr;
 
-            setValue(m_value + valueToIncrementBy);
+}
 
-        }
+/*
+ * Will increment the value at the significant figure's index.
+ * If this value overflows above its maximum range, it will attempt to carry the increment operation
+ * over to a Range to its left, if possible.
+ */
+bool RangeInt::increment(int index){
 
-    }
-    //Incrementing a negative number (Should make the number approach 0 (i.e. -20 + 10 = -10)
-    else if(m_value < 0LL){
+    return stepBy(1LL, index);
 
-        //If we increment our value above 0, but we're supposed to be negative (i.e. -05 + 10 = -55 && increment the left)
-        if(safeAdd(m_value, valueToIncrementBy) > 0LL){
+}
 
-            //If all values to our left are zeroed out, but we can flip the RangeChar (i.e. S -> N or W -> E),
-            //then our addition carry will be satisfied by the RangeChar's incrementation
-            bool flippingFromNegToPos = allValuesToLeftAreZero() && leftMostRange() != nullptr && leftMostRange()->increment(0);
+/*
+ * Will decrement the value at the significant figure's index.
+ * If this value underflows below its negated maximum range, it will attempt to carry the decrement operation
+ * over to a Range to its left, if possible.
+ */
+bool RangeInt::decrement(int index){
 
-            if(flippingFromNegToPos){
+    return stepBy(-1LL, index);
 
-                setValue(-m_value);
+}
 
-            }
-            //If not everything to the left is zeroed out, that means we should forward the carry bit to our left range
-            else if(m_carryOrBorrowFromLeft && m_leftRange != nullptr && m_leftRange->increment(0)){
+/*
+ * Adds steps * 10^index of this Range's unit to the whole value of its carry chain, then writes the result back into every RangeInt of the chain.
+ * The chain is read as a single mixed-radix integer counted in units of its least significant RangeInt (i.e. 1/3600 of a degree for D°M'S''),
+ * so a step is one add and one clamp no matter how far the carry or borrow travels, or how many units are stepped at once.
+ */
+bool RangeInt::stepBy(long long steps, int index){
 
-                //(i.e. S01 05' -> S00 55')
-                setValue(-m_range + (valueToIncrementBy + m_value - 1LL));
+    //Production::Note: The index refers to the significant figure index (right to left indexing)
+    //This determines if we're at the "ones", "tens", "hundreds", etc. place to determine
+    //what this widget will step by
 
-            }
-            //If there's no left ranges at all, attempt to treat this as a stand alone value that can be made positive
-            else{
+    //Find the most significant RangeInt we can carry into or borrow from
+    RangeInt* chainHead = this;
+    while(chainHead->m_carryOrBorrowFromLeft){
 
-                setValue(m_value + valueToIncrementBy);
+        RangeInt* previous = chainHead->previousRangeInt();
+        if(previous == nullptr){
 
-            }
+            break;
 
         }
-        //Else we can just increment because we're still going to be negative (i.e. -15 + 10 = -05)
-        else{
 
-            setValue(m_value + valueToIncrementBy);
-
-        }
+        chainHead = previous;
 
     }
-    //This is a special case, depending on if our left-most RangeChar is positive or not
-    else{
 
-        //If the whole value is positive, we can safely increment
-        if(leftMostRangeCharSign() == true && safeAdd(m_value, valueToIncrementBy) < m_range){
+    //Only the head Range may be the sign, and only the most significant chain may flip it
+    Range*     head           = chainHead->leftMostRange();
+    RangeChar* signChar       = (head != nullptr && head->m_kind == RANGE_CHAR) ? static_cast<RangeChar*>(head) : nullptr;
+    bool       canFlipSign    = (signChar != nullptr && chainHead->previousRangeInt() == nullptr);
+    bool       chainIsSigned  = true;
+    bool       negative       = (signChar != nullptr && signChar->m_value != signChar->m_positiveChar);
 
-            setValue(m_value + valueToIncrementBy);
+    //Horner's method from the head accumulates the whole magnitude, while the unit weights
+    //of this RangeInt and of the head are the products of the radices to their right
+    WideInt   magnitude    = 0;
+    WideInt   unitWeight   = 1;
+    WideInt   headWeight   = 1;
+    bool      passedThis   = false;
+    RangeInt* chainTail    = chainHead;
+    for(RangeInt* rangeInt = chainHead; rangeInt != nullptr; rangeInt = nextCarryRangeInt(rangeInt)){
 
-        }
-        //If the whole value is negative (Or we're exceeding our range), we need to check if everything to our left is zeroed out or not
-        else{
-
-            if(allValuesToLeftAreZero() && (safeAdd(m_value, valueToIncrementBy) < m_range) ){
+        const WideInt radix = WideInt(rangeInt->m_range) + 1;
 
-                //Should increment the RangeChar from its negative sign to its positive sign
-                if(leftMostRange() != nullptr && leftMostRange()->increment(0)){
+        magnitude = saturatingAdd(saturatingMultiply(magnitude, radix), rangeInt->m_value < 0LL ? -WideInt(rangeInt->m_value) : WideInt(rangeInt->m_value));
 
-                    setValue(m_value + valueToIncrementBy);
+        if(rangeInt != chainHead){
 
-                }
+            headWeight = saturatingMultiply(headWeight, radix);
 
-            }else{
+        }
 
-                //We're actually incrementing a negative left neighboring range instead
-                if(m_carryOrBorrowFromLeft && m_leftRange != nullptr && m_leftRange->increment(0)){
+        if(passedThis){
 
-                    setValue(-m_range - 1LL + valueToIncrementBy);
+            unitWeight = saturatingMultiply(unitWeight, radix);
 
-                }else{
+        }
 
-                    setValue(-m_range);
+        passedThis    |= (rangeInt == this);
+        chainIsSigned &= rangeInt->m_signed;
+        chainTail      = rangeInt;
 
-                }
+        //Without a RangeChar, the RangeInts carry the sign themselves
+        if(signChar == nullptr && rangeInt->m_value < 0LL){
 
-            }
+            negative = true;
 
         }
 
     }
 
-    m_dirty = (m_value != originalValue);
-
-    return m_dirty;
-
-}
-
-/*
- * Will decrement the value at the significant figure's index.
- * If this value underflows below its negated maximum range, it will attempt to carry the decrement operation
- * over to a Range to its left, if possible.
- */
-bool RangeInt::decrement(int index){
-
-    //Production::Note: The index refers to the significant figure index (right to left indexing)
-    //This determines if we're at the "ones", "tens", "hundreds", etc. place to determine
-    //what this widget will decrement by
-
-    long long valueToDecrementBy = std::pow(10LL, index);
-    long long originalValue      = m_value;
+    //Production::Note: The head's range is the chain's maximum (i.e. 90°00'00'' for latitude), matching maximumExceededFixup(),
+    //and a chain that can't flip its sign may only move towards 0 on its current side of it
+    const WideInt maximum = saturatingMultiply(chainHead->m_range, headWeight);
+    WideInt lowerBound = -maximum;
+    WideInt upperBound =  maximum;
+    if(signChar != nullptr ? canFlipSign == false : chainIsSigned == false){
 
-    //Decrementing a positive number (i.e. 20 - 10 = 10)
-    if(m_value > 0LL){
+        lowerBound = negative ? -maximum : 0;
+        upperBound = negative ? 0        : maximum;
 
-        //We're borrowing a negative from our left (if all non-zero) or the rangeChar
-        if(m_carryOrBorrowFromLeft && (safeAdd(m_value, -valueToDecrementBy) < 0LL) ){
+    }
 
-            bool flippingFromPosToNeg = allValuesToLeftAreZero() && leftMostRange() != nullptr && leftMostRange()->decrement(0);
+    //|steps| saturates rather than negating LLONG_MIN when WideInt is only a long long
+    const WideInt stepMagnitude = (steps < 0LL) ? -WideInt(steps == LLONG_MIN ? -LLONG_MAX : steps) : WideInt(steps);
+    const WideInt delta         = saturatingMultiply(saturatingMultiply(pow10Wide(index), unitWeight), stepMagnitude);
 
-            if(flippingFromPosToNeg){
+    WideInt wholeValue = saturatingAdd(negative ? -magnitude : magnitude, (steps < 0LL) ? -delta : delta);
+    wholeValue         = std::min(std::max(wholeValue, lowerBound), upperBound);
 
-                setValue(-m_value);
+    //Landing on 0 keeps whichever sign we already had
+    const bool resultNegative = (wholeValue < 0) || (wholeValue == 0 && negative);
+    bool       changed(false);
 
-            }else if(m_leftRange != nullptr && m_leftRange->decrement(0)){
+    if(canFlipSign && resultNegative != negative){
 
-                //(i.e. N01 05' - 10' -> N00 55')
-                setValue(m_range - (llabs(valueToDecrementBy - m_value) - 1LL));
+        changed = resultNegative ? signChar->decrement(0) : signChar->increment(0);
 
-            }else{
+    }
 
-                setValue(m_value - valueToDecrementBy);
+    //Decompose back into each RangeInt, least significant first.
+    //Production::Note: The clamp above guarantees whatever remains for the chain's head fits within its range
+    WideInt remaining = (wholeValue < 0) ? -wholeValue : wholeValue;
+    for(Range* rangeIter = chainTail; rangeIter != nullptr; rangeIter = rangeIter->m_leftRange){
 
-            }
+        if(rangeIter->m_kind != RANGE_INT){
 
-        }else{
-
-            setValue(safeAdd(m_value, -valueToDecrementBy));
+            continue;
 
         }
 
-    }
-    //Decrementing a negative number (i.e. -20 - 10 = -30)
-    else if(m_value < 0LL){
-
-        //If we underflow (i.e. -55 - 10 = -05 IF we can borrow from our left)
-        if(safeAdd(m_value, -valueToDecrementBy) < -m_range){
+        RangeInt* rangeInt = static_cast<RangeInt*>(rangeIter);
+        long long digit    = 0LL;
 
-            //If we can decrement the left range
-            if(m_carryOrBorrowFromLeft && m_leftRange != nullptr && m_leftRange->decrement(0)){
+        if(rangeInt == chainHead){
 
-                //(i.e. -55 - 10 + 59 + 1 = -65 + 60 = -5)
-                setValue(m_value - valueToDecrementBy + m_range + 1LL);
-
-            }else{
-
-                setValue(-m_range);
-
-            }
+            digit = static_cast<long long>(remaining);
 
         }else{
 
-            //(i.e. -45 - 10 = -55)
-            setValue(safeAdd(m_value, -valueToDecrementBy));
+            const WideInt radix = WideInt(rangeInt->m_range) + 1;
+            digit     = static_cast<long long>(remaining % radix);
+            remaining = remaining / radix;
 
         }
 
-    }
-    //This is a special case, depending on if our left neighbor is the RangeChar or not
-    else{
-
-        if(leftMostRangeCharSign() == true){
-
-            if(allValuesToLeftAreZero() == true){
-
-                //Will attempt to flip the 'N' -> 'S' and borrow from the sign to allow us to become negative
-                if(leftMostRange() != nullptr){
-
-                    leftMostRange()->decrement(0);
-
-                }
-
-                //If there is no RangeChar, then let us do it anyway and assume -m_range is our limit
-                setValue(safeAdd(m_value, -valueToDecrementBy));
-
-            }
-            //Else not everything to our left is negative and we should be able to borrow from our left
-            else{
-
-                if(m_carryOrBorrowFromLeft && m_leftRange != nullptr && m_leftRange->decrement(0)){
-
-                    //(i.e. N01 00' - 10' -> N00 50')
-                    setValue(m_range - (llabs(valueToDecrementBy - m_value) - 1LL));
-
-                }else{
+        const long long newValue = resultNegative ? -digit : digit;
+        if(rangeInt->m_value != newValue){
 
-                    setValue(safeAdd(m_value, -valueToDecrementBy));
-
-                }
-
-            }
+            rangeInt->m_value = newValue;
+            rangeInt->m_dirty = true;
+            changed           = true;
+            rangeInt->syncLayoutState();
 
         }
-        //Else we're negative already, so we should be able to just subtract
-        else{
 
-            setValue(safeAdd(m_value, -valueToDecrementBy));
+        if(rangeInt == chainHead){
+
+            break;
 
         }
 
     }
 
-    m_dirty = (m_value != originalValue);
-
-    return m_dirty;
+    return changed;
 
 }
 
@@ -751,7 +922,7 @@ bool RangeInt::decrement(int index){
  */
 int RangeInt::valueLength(){
 
-    return QString::number(llabs(m_value)).length();
+    return digitCount(static_cast<unsigned long long>(llabs(m_value)));
 
 }
 
@@ -760,7 +931,7 @@ int RangeInt::valueLength(){
  */
 int RangeInt::rangeLength(){
 
-    return QString::number(m_range).length();
+    return m_rangeLength;
 
 }
 
@@ -771,13 +942,32 @@ int RangeInt::rangeLength(){
  */
 QString RangeInt::valueStr(){
 
-    return QString("0").repeated(rangeLength() - valueLength()) + QString::number(llabs(m_value));
+    const unsigned long long absoluteValue = static_cast<unsigned long long>(llabs(m_value));
+
+    if(m_rangeLength <= MAX_TABULATED_RANGE_LENGTH){
+
+        const QVector<QString>* table = paddedDigitTable(m_rangeLength);
+        if(Q_LIKELY(table != nullptr && absoluteValue < static_cast<unsigned long long>(table->size()))){
+
+            return table->at(static_cast<int>(absoluteValue));
+
+        }
+
+    }
+
+    //Production::Note: A long long never needs more than 19 digits.
+    //A value written directly past its range still prints all of its digits, rather than being truncated.
+    const int width = std::max(m_rangeLength, digitCount(absoluteValue));
+    QChar buffer[20];
+    writePaddedDigits(absoluteValue, width, buffer);
+
+    return QString(buffer, width);
 
 }
 
 /*
  * Returns "RangeInt"
- * Used to avoid dynamic casting whenever possible
+ * Production::Note: Kept for diagnostics only, dispatch on m_kind instead
  */
 QString RangeInt::rangeType(){
 
@@ -806,18 +996,26 @@ bool RangeInt::setValueForIndex(const QChar& value, int index){
 
     //This allows single digit replacement while getting keyboard input from the user.
     //For example, Degrees goes from [000, 180]
-    //We attempt to replace the value for index string and convert the value back to an int and then verify it's within range.
+    //We swap the digit at index arithmetically and then verify it's within range.
     //(i.e. value = 7 && index == 1, -> [070]
-    if(QRegExp("\\d").exactMatch(value)){
+    //Production::Note: Only ASCII digits are accepted, which is all the old QString::toLongLong(...) round trip could parse
+    const ushort digitChar = value.unicode();
+    if(digitChar >= u'0' && digitChar <= u'9' && index >= 0 && index < m_rangeLength){
+
+        //Unsigned, so even a 19 digit range has headroom for swapping in a 9
+        const unsigned long long place     = static_cast<unsigned long long>(pow10LL(m_rangeLength - 1 - index));
+        const unsigned long long magnitude = static_cast<unsigned long long>(llabs(m_value));
+        const unsigned long long oldDigit  = (magnitude / place) % 10ULL;
+        const unsigned long long newDigit  = static_cast<unsigned long long>(digitChar - u'0');
 
-        bool success(false);
-        long long attemptedValue = valueStr().replace(index, 1, value).toLongLong(&success) * (m_value >= 0LL ? 1LL : -1LL);
+        const unsigned long long attemptedMagnitude = magnitude - oldDigit * place + newDigit * place;
 
-        if(success && llabs(attemptedValue) <= m_range){
+        if(attemptedMagnitude <= static_cast<unsigned long long>(m_range)){
 
-            m_value = attemptedValue;
+            m_value = static_cast<long long>(attemptedMagnitude) * (m_value >= 0LL ? 1LL : -1LL);
             m_dirty = true;
             valueWasSet = true;
+            syncLayoutState();
 
         }
 
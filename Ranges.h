@@ -4,6 +4,7 @@
 #include <QString>
 
 struct RangeInt;
+struct RangeChar;
 
 /*! struct Range
  *
@@ -19,10 +20,22 @@ struct RangeInt;
  */
 struct Range{
 
+    /*! enum Kind
+     * Non-virtual tag denoting which subclass a Range is.
+     * Set once at construction, so hot paths can dispatch on it without a virtual call or building a QString.
+     * Production::Note: The underlying type is fixed and unsigned, otherwise MSVC reads RANGE_INT back out of m_kind's bitfield as -2
+     */
+    enum Kind : quint8{
+        RANGE_CHAR,
+        RANGE_STRING_CONSTANT,
+        RANGE_INT
+    };
+
     /*
-     * Default Constructor
+     * Value Constructor
+     * @PARAM Kind kind - The subclass tag of the Range being constructed
      */
-    Range();
+    explicit Range(Kind kind);
 
     /*
      * Destructor
@@ -44,6 +57,14 @@ struct Range{
      */
     virtual bool decrement(int index) = 0;
 
+    /*
+     * Pure virtual
+     * Attempts to step the significant figure's index by steps in one pass, carrying or borrowing as far as needed.
+     * @PARAM long long steps - How many units to step by, negative to step down
+     * @PARAM int       index - Significant figure's index (Right to left indexing)
+     */
+    virtual bool stepBy(long long steps, int index) = 0;
+
     /*
      * Pure virtual
      * The length of the value, when converted to its stringified version
@@ -65,7 +86,7 @@ struct Range{
     /*
      * Pure virtual
      * The subclass type's string
-     * Used to avoid dynamic casting whenever possible
+     * Production::Note: Kept for diagnostics only, dispatch on m_kind instead since this allocates a QString per call
      */
     virtual QString rangeType() = 0;
 
@@ -88,6 +109,7 @@ struct Range{
     /*
      * Attempts to return whichever Range type is the head of the Ranges.
      * Will return nullptr if this is called on the head.
+     * Constant time once the layout caches are set, otherwise walks m_leftRange.
      */
     virtual Range* leftMostRange();
 
@@ -95,26 +117,60 @@ struct Range{
      * Attempts to return whichever RangeInt type is the most significant value of all Ranges.
      * Will return itself if it's already the left-most RangeInt.
      * Will return nullptr if this is not a RangeInt and there are no RangeInt types to its left.
+     * Constant time once the layout caches are set, otherwise walks m_leftRange.
      */
     virtual RangeInt* leftMostRangeInt();
 
     /*
      * Checks all RangeInt types to the left of `this` for a non-zero RangeInt.
      * Used in conjunction with RangeInt's increment and decrement specifically for edge case behavior.
+     * Constant time once the layout caches are set (a mask test against the layout's non-zero RangeInt bits), otherwise walks m_leftRange.
      */
     virtual bool allValuesToLeftAreZero();
 
     /*
      * Returns if the left-most RangeChar is currently in its positive (true) or negative (false) state.
      * Used in conjunction with RangeInt's increment and decrement specifically for edge case behavior.
+     * Constant time once the layout caches are set, otherwise walks m_leftRange.
      */
     virtual bool leftMostRangeCharSign();
 
-    int    m_charIndexStart;
-    int    m_charIndexEnd;
-    Range* m_leftRange;
-    Range* m_rightRange;
-    bool   m_dirty;
+    /*
+     * Returns the closest RangeInt to the left of this Range, or nullptr if there isn't one.
+     */
+    RangeInt* previousRangeInt();
+
+    /*
+     * Returns the closest RangeInt to the right of this Range, or nullptr if there isn't one.
+     */
+    RangeInt* nextRangeInt();
+
+    //Production::Note: Members are ordered widest first, so no padding sits between them, and the kind and dirty flag share a single byte
+    Range*     m_leftRange;
+    Range*     m_rightRange;
+
+    //Layout caches, filled in by RangeLineEdit::syncRangeLists() whenever the layout changes.
+    //A Range that was never part of a RangeLineEdit keeps m_headRange as nullptr, and the queries above fall back to walking the list.
+    Range*     m_headRange;
+    RangeInt*  m_leftMostRangeInt;
+    RangeChar* m_leftMostRangeChar;
+    RangeInt*  m_previousRangeInt;
+    RangeInt*  m_nextRangeInt;
+    quint64*   m_nonZeroRangeInts;
+    quint64*   m_negativeRangeInts;
+
+    //Shared by the whole layout and bumped by every RangeInt value or divisor change, so a RangeLineEdit can tell when its cached value is stale
+    quint64*   m_valueRevision;
+
+    int        m_charIndexStart;
+    int        m_charIndexEnd;
+
+    //How many RangeInts sit to the left of this Range, which is also a RangeInt's bit in the shared m_nonZeroRangeInts and m_negativeRangeInts masks.
+    //Only the first 64 RangeInts of a layout have a bit, so allValuesToLeftAreZero() walks the list past that
+    int        m_rangeIntsToLeft;
+
+    const Kind m_kind  : 2;
+    bool       m_dirty : 1;
 
 };
 
@@ -134,7 +190,7 @@ struct Range{
  * Production::Note: There should only be one of these classes used in a PositionalLineEdit.
  *
  */
-struct RangeChar : public Range{
+struct RangeChar final : public Range{
 
     /*
      * Value Constructor
@@ -164,6 +220,14 @@ struct RangeChar : public Range{
      */
     bool decrement(int index = 0) override;
 
+    /*
+     * Flips to the positive state for positive steps, or to the negative state for negative steps.
+     * Returns false if steps is 0 or the state didn't change.
+     * @PARAM long long steps - Only the sign is used
+     * @PARAM int       index - Unused for this Range type
+     */
+    bool stepBy(long long steps, int index = 0) override;
+
     /*
      * Should always return 1, since this represents a QChar
      */
@@ -181,7 +245,7 @@ struct RangeChar : public Range{
 
     /*
      * Returns "RangeChar"
-     * Used to avoid dynamic casting whenever possible
+     * Production::Note: Kept for diagnostics only, dispatch on m_kind instead
      */
     QString rangeType() override;
 
@@ -219,7 +283,7 @@ struct RangeChar : public Range{
  * is passed along to its left Range, if it has one, otherwise it will always be true.
  *
  */
-struct RangeStringConstant : public Range{
+struct RangeStringConstant final : public Range{
 
     /*
      * Value Constructor
@@ -241,6 +305,14 @@ struct RangeStringConstant : public Range{
      */
     bool decrement(int index = 0) override;
 
+    /*
+     * Unused by this type.
+     * Forwards the call to its left Range's least significant figure, otherwise will always return true.
+     * @PARAM long long steps - How many units to step the left Range by
+     * @PARAM int       index - Unused
+     */
+    bool stepBy(long long steps, int index = 0) override;
+
     /*
      * Returns the length of the string this Range was constructed with
      */
@@ -258,7 +330,7 @@ struct RangeStringConstant : public Range{
 
     /*
      * Returns "RangeStringConstant"
-     * Used to avoid dynamic casting whenever possible
+     * Production::Note: Kept for diagnostics only, dispatch on m_kind instead
      */
     QString rangeType() override;
 
@@ -301,7 +373,7 @@ struct RangeStringConstant : public Range{
  * the maximum value when used in the context of a PositionalLineEdit. (i.e. 180 for longitude, 90 for latitude)
  *
  */
-struct RangeInt : public Range{
+struct RangeInt final : public Range{
 
     /*
      * Value Constructor
@@ -316,6 +388,7 @@ struct RangeInt : public Range{
     /*
      * Convenience function to change the maximum value of the Range dynamically.
      * Ensures if lowering the range that the current stored value is still valid.
+     * Caches the stringified width of the range so rangeLength() and valueStr() never have to format it.
      * @PARAM long long range - The maximum value of the Range (In both the positive and negative direction)
      */
     bool setRange(long long range);
@@ -332,10 +405,18 @@ struct RangeInt : public Range{
      * Convenience function to help set the value, while ensuring the range limits are being observed, when either positive or negative.
      * For example, if the value is 70, but our range is 59, this will truncate the value to just set 59.
      * This will always be called before adjacent Ranges were incremented accordingly due to what this value is attempting to become.
+     * Marks the Range dirty if its value changed, so the next scrape picks it up.
      * @PARAM long long value - The value to attempt setting our current value to. Will be limited by this RangeInt's range.
      */
     void setValue(long long value);
 
+    /*
+     * Updates the layout's shared state after m_value changed:
+     * sets or clears this RangeInt's bit in the non-zero and negative masks to match m_value, and bumps the value revision.
+     * Must be called whenever m_value changes, which setValue(...) does for you.
+     */
+    void syncLayoutState();
+
     /*
      * Will increment the value at the significant figure's index.
      * If this value overflows above its maximum range, it will attempt to carry the increment operation
@@ -352,6 +433,16 @@ struct RangeInt : public Range{
      */
     bool decrement(int index) override;
 
+    /*
+     * Treats every RangeInt linked to this one by carries as one signed mixed-radix integer, adds steps * 10^index of this Range's unit to it,
+     * clamps it to what the chain can represent, and writes it back into each RangeInt (and the head RangeChar, if the sign flipped).
+     * However large steps is, this costs one pass over the chain, and the result saturates at the chain's limits instead of overflowing.
+     * Returns true if any Range changed.
+     * @PARAM long long steps - How many units to step by, negative to step down
+     * @PARAM int       index - The significant figure's index (Right to left indexing) to step at
+     */
+    bool stepBy(long long steps, int index) override;
+
     /*
      * The length of this Range's value when converted to a string, without preleading zeroes.
      */
@@ -359,6 +450,7 @@ struct RangeInt : public Range{
 
     /*
      * The length of this Range's stringified maximum value.
+     * Returns the width cached by setRange(...)
      */
     int rangeLength() override;
 
@@ -366,12 +458,14 @@ struct RangeInt : public Range{
      * Returns the stringified representation of this Range's value.
      * If the current number mismatches the amount of significant figures when compared to its maximum value,
      * it will prepend leading '0' characters to pad the value properly to maintain the same stringified length as its maximum range's string.
+     * Production::Note: Ranges up to 4 digits wide return a shared, pre-padded string from a process-wide table (no allocation),
+     * wider ranges are formatted into a stack buffer and copied into the returned string once.
      */
     QString valueStr () override;
 
     /*
      * Returns "RangeInt"
-     * Used to avoid dynamic casting whenever possible
+     * Production::Note: Kept for diagnostics only, dispatch on m_kind instead
      */
     QString rangeType() override;
 
@@ -393,6 +487,7 @@ struct RangeInt : public Range{
     long long  m_range;
     long long  m_value;
     long long  m_divisor;
+    int        m_rangeLength;
     bool       m_carryOrBorrowFromLeft;
     bool       m_signed;
 
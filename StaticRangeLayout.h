@@ -0,0 +1,397 @@
+#ifndef STATICRANGELAYOUT_H
+#define STATICRANGELAYOUT_H
+
+#include "Ranges.h"
+#include "RangePool.h"
+
+#include <QList>
+
+#include <algorithm>
+#include <climits>
+#include <tuple>
+#include <type_traits>
+
+/*! namespace StaticRange
+ *
+ * Compile-time descriptions of the Range types, to be listed in a StaticRangeLayout.
+ * Each one knows its kind, width and placeholder text as constants, and how to create its runtime Range in a RangePool.
+ *
+ * Usage examples would include:
+ *     1. latitude sign: StaticRange::SignChar<u'S', u'N'>
+ *     2.       degrees: StaticRange::Int<90, 1>
+ *     3.  degree sign : StaticRange::Const<u'°'>
+ *     4.  second sign : StaticRange::Const<u'\'', u'\''>
+ *
+ * Production::Note: String literals can't be template arguments before C++20, so constants are spelled out as a char16_t pack.
+ */
+namespace StaticRange{
+
+/*
+ * Returns the number of decimal digits in value (value >= 0)
+ */
+constexpr int digitCount(long long value){
+
+    return value < 10LL ? 1 : 1 + digitCount(value / 10LL);
+
+}
+
+/*! struct SignChar
+ *
+ * Compile-time RangeChar. Displays its positive character until told otherwise.
+ */
+template <char16_t NegativeChar, char16_t PositiveChar>
+struct SignChar{
+
+    typedef RangeChar RangeType;
+
+    static constexpr Range::Kind KIND      = Range::RANGE_CHAR;
+    static constexpr int         WIDTH     = 1;
+    static constexpr long long   RANGE     = 0LL;
+    static constexpr bool        CARRIES   = false;
+
+    static constexpr char16_t placeholder(int){
+
+        return PositiveChar;
+
+    }
+
+    static RangeChar* create(RangePool& pool){
+
+        return pool.create<RangeChar>(QChar(NegativeChar), QChar(PositiveChar));
+
+    }
+
+};
+
+/*! struct Int
+ *
+ * Compile-time RangeInt. Its width is the digit count of its range, and its placeholder is all '0's.
+ */
+template <long long RangeValue, long long Divisor, bool CarryOrBorrowFromLeft = true, bool IsSigned = true>
+struct Int{
+
+    static_assert(RangeValue > 0LL, "StaticRange::Int must have a range > 0");
+    static_assert(Divisor    > 0LL, "StaticRange::Int must have a divisor > 0");
+
+    typedef RangeInt RangeType;
+
+    static constexpr Range::Kind KIND      = Range::RANGE_INT;
+    static constexpr int         WIDTH     = digitCount(RangeValue);
+    static constexpr long long   RANGE     = RangeValue;
+    static constexpr bool        CARRIES   = CarryOrBorrowFromLeft;
+
+    static constexpr char16_t placeholder(int){
+
+        return u'0';
+
+    }
+
+    static RangeInt* create(RangePool& pool){
+
+        return pool.create<RangeInt>(RangeValue, Divisor, CarryOrBorrowFromLeft, IsSigned);
+
+    }
+
+};
+
+/*! struct Const
+ *
+ * Compile-time RangeStringConstant.
+ */
+template <char16_t... Chars>
+struct Const{
+
+    static_assert(sizeof...(Chars) > 0, "StaticRange::Const must have at least one character");
+
+    typedef RangeStringConstant RangeType;
+
+    static constexpr Range::Kind KIND      = Range::RANGE_STRING_CONSTANT;
+    static constexpr int         WIDTH     = sizeof...(Chars);
+    static constexpr long long   RANGE     = 0LL;
+    static constexpr bool        CARRIES   = false;
+
+    static constexpr char16_t placeholder(int index){
+
+        const char16_t chars[] = {Chars...};
+        return chars[index];
+
+    }
+
+    /*
+     * The constant's text, built once per process and shared (by reference count) with every Range created from it
+     */
+    static const QString& text(){
+
+        static const QChar   chars[] = {QChar(Chars)...};
+        static const QString value(chars, WIDTH);
+
+        return value;
+
+    }
+
+    static RangeStringConstant* create(RangePool& pool){
+
+        return pool.create<RangeStringConstant>(text());
+
+    }
+
+};
+
+}
+
+/*! struct StaticRangeLayout
+ *
+ * A fixed sequence of StaticRange elements, whose offsets, widths, placeholder text, cursor table and carry weights are all constexpr.
+ * It creates the matching runtime Ranges (so everything built on m_ranges keeps working, and dynamic layouts keep using the Range hierarchy directly),
+ * hands them back with their concrete types so calls on them are devirtualized, and splits a whole value into its RangeInts with the radices
+ * baked in as constants, so the carry chain unrolls into a fixed series of constant divisions.
+ *
+ * Usage example:
+ *     typedef StaticRangeLayout<StaticRange::Int<999, 1, false>, StaticRange::Const<u'-'>, StaticRange::Int<9999, 1, false>> Layout;
+ *     Layout::build(m_rangePool, m_ranges);
+ *     RangeInt* lastFour = Layout::at<2>(m_ranges);
+ */
+template <typename... Elements>
+struct StaticRangeLayout{
+
+    static_assert(sizeof...(Elements) > 0, "StaticRangeLayout must have at least one element");
+
+    static constexpr int RANGE_COUNT = sizeof...(Elements);
+
+    template <int RangeIndex>
+    using ElementAt = typename std::tuple_element<RangeIndex, std::tuple<Elements...>>::type;
+
+    /*
+     * The kind of the Range at rangeIndex
+     */
+    static constexpr Range::Kind kind(int rangeIndex){
+
+        const Range::Kind kinds[] = {Elements::KIND...};
+        return kinds[rangeIndex];
+
+    }
+
+    /*
+     * The displayed width of the Range at rangeIndex
+     */
+    static constexpr int width(int rangeIndex){
+
+        const int widths[] = {Elements::WIDTH...};
+        return widths[rangeIndex];
+
+    }
+
+    /*
+     * The character index the Range at rangeIndex starts at (Its m_charIndexStart)
+     */
+    static constexpr int offset(int rangeIndex){
+
+        int charIndex(0);
+        for(int i = 0; i < rangeIndex; ++i){
+
+            charIndex += width(i);
+
+        }
+
+        return charIndex;
+
+    }
+
+    static constexpr int TEXT_LENGTH = offset(RANGE_COUNT);
+
+    /*
+     * Cursor table lookup: the index of the Range displayed at charIndex, or -1 if charIndex is outside of the text
+     */
+    static constexpr int rangeIndexForCharIndex(int charIndex){
+
+        int rangeIndex(-1);
+        for(int i = 0; i < RANGE_COUNT && charIndex >= 0; ++i){
+
+            if(charIndex < offset(i) + width(i)){
+
+                rangeIndex = i;
+                break;
+
+            }
+
+        }
+
+        return rangeIndex;
+
+    }
+
+    /*
+     * The character displayed at charIndex when every Range is zeroed (Positive sign, '0' digits, constant text)
+     */
+    static constexpr char16_t placeholder(int charIndex){
+
+        const int rangeIndex = rangeIndexForCharIndex(charIndex);
+        const int localIndex = charIndex - offset(rangeIndex);
+
+        //Production::Note: Only the matching element is ever evaluated, the others just pass the result along
+        char16_t result(0);
+        int      i     (0);
+        using expand = int[];
+        (void)expand{0, (result = (i == rangeIndex ? Elements::placeholder(localIndex) : result), ++i)...};
+
+        return result;
+
+    }
+
+    /*
+     * The radix the Range at rangeIndex contributes to a whole value (range + 1 for a RangeInt, 1 for anything else)
+     */
+    static constexpr long long radix(int rangeIndex){
+
+        const long long ranges[] = {Elements::RANGE...};
+        return kind(rangeIndex) == Range::RANGE_INT ? ranges[rangeIndex] + 1LL : 1LL;
+
+    }
+
+    /*
+     * How many units of the least significant RangeInt one unit of the Range at rangeIndex is worth, within its carry chain.
+     * (i.e. 3600 for degrees, 60 for minutes, 1 for seconds)
+     */
+    static constexpr long long unitWeight(int rangeIndex){
+
+        const bool carries[] = {Elements::CARRIES...};
+
+        long long weight(1LL);
+        for(int i = rangeIndex + 1; i < RANGE_COUNT; ++i){
+
+            if(kind(i) == Range::RANGE_INT){
+
+                if(carries[i] == false){
+
+                    break;
+
+                }
+
+                weight *= radix(i);
+
+            }
+
+        }
+
+        return weight;
+
+    }
+
+    /*
+     * The largest whole value every RangeInt can display together, in units of the least significant RangeInt, ignoring carry flags.
+     * (i.e. 9999999999 for a ###-###-#### phone number)
+     */
+    static constexpr long long maximumWholeValue(){
+
+        long long maximum(0LL);
+        for(int i = 0; i < RANGE_COUNT; ++i){
+
+            maximum = maximum * radix(i) + (radix(i) - 1LL);
+
+        }
+
+        return maximum;
+
+    }
+
+    /*
+     * Creates every Range of the layout in pool, appending them to ranges in order
+     * @PARAM RangePool&      pool   - The widget's RangePool
+     * @PARAM QList<Range*>&  ranges - The widget's m_ranges
+     */
+    static void build(RangePool& pool, QList<Range*>& ranges){
+
+        using expand = int[];
+        (void)expand{0, (ranges << Elements::create(pool), 0)...};
+
+    }
+
+    /*
+     * Returns the Range at RangeIndex with its concrete type, no runtime type check required
+     * @PARAM const QList<Range*>& ranges - The widget's m_ranges
+     * @PARAM int                  first  - Where this layout starts in ranges, if something was prepended to it
+     */
+    template <int RangeIndex>
+    static typename ElementAt<RangeIndex>::RangeType* at(const QList<Range*>& ranges, int first = 0){
+
+        return static_cast<typename ElementAt<RangeIndex>::RangeType*>(ranges.at(first + RangeIndex));
+
+    }
+
+    /*
+     * Splits a non-negative whole value across every RangeInt of the layout (least significant first), treating them as one mixed-radix number.
+     * Whatever doesn't fit in the other RangeInts is left for the most significant one, which clamps it to its range.
+     * The radices are compile-time constants, so the loop unrolls into constant divisions.
+     * @PARAM unsigned long long   wholeValue - The value, in units of the least significant RangeInt
+     * @PARAM const QList<Range*>& ranges     - The widget's m_ranges
+     * @PARAM int                  first      - Where this layout starts in ranges, if something was prepended to it
+     */
+    static void decomposeWholeValue(unsigned long long wholeValue, const QList<Range*>& ranges, int first = 0){
+
+        decomposeFrom(wholeValue, ranges, first, std::integral_constant<int, RANGE_COUNT - 1>());
+
+    }
+
+private:
+
+    /*
+     * Helper function to terminate the unrolled decomposition
+     */
+    static void decomposeFrom(unsigned long long, const QList<Range*>&, int, std::integral_constant<int, -1>){
+
+        /* NOP */
+
+    }
+
+    /*
+     * Helper function that peels the RangeInt (if any) at RangeIndex off of wholeValue, then moves on to the Range to its left
+     */
+    template <int RangeIndex>
+    static void decomposeFrom(unsigned long long wholeValue, const QList<Range*>& ranges, int first, std::integral_constant<int, RangeIndex>){
+
+        if(kind(RangeIndex) == Range::RANGE_INT){
+
+            RangeInt* rangeInt = static_cast<RangeInt*>(ranges.at(first + RangeIndex));
+
+            if(RangeIndex == firstRangeIntIndex()){
+
+                rangeInt->setValue(static_cast<long long>(std::min(wholeValue, static_cast<unsigned long long>(LLONG_MAX))));
+
+            }else{
+
+                constexpr unsigned long long RADIX = static_cast<unsigned long long>(radix(RangeIndex));
+                rangeInt->setValue(static_cast<long long>(wholeValue % RADIX));
+                wholeValue /= RADIX;
+
+            }
+
+        }
+
+        decomposeFrom(wholeValue, ranges, first, std::integral_constant<int, RangeIndex - 1>());
+
+    }
+
+    /*
+     * The index of the most significant RangeInt, or -1 if there isn't one
+     */
+    static constexpr int firstRangeIntIndex(){
+
+        int rangeIndex(-1);
+        for(int i = 0; i < RANGE_COUNT; ++i){
+
+            if(kind(i) == Range::RANGE_INT){
+
+                rangeIndex = i;
+                break;
+
+            }
+
+        }
+
+        return rangeIndex;
+
+    }
+
+};
+
+#endif // STATICRANGELAYOUT_H